@@ -35,8 +35,9 @@ namespace UnrealEngine.Framework {
 	// Automatically generated
 
 	internal static class Shared {
-		internal const int checksum = 0x16; //0x2F0;
+		internal const int checksum = 0x4D; //0x2F0;
 		internal static Dictionary<int, IntPtr> userFunctions = new();
+		internal static List<MethodInfo> entryPoints = new();
 		private const string dynamicTypesAssemblyName = "UnrealEngine.DynamicTypes";
 		private static readonly ModuleBuilder moduleBuilder = AssemblyBuilder.DefineDynamicAssembly(new(dynamicTypesAssemblyName), AssemblyBuilderAccess.RunAndCollect).DefineDynamicModule(dynamicTypesAssemblyName);
 		private static readonly Type[] delegateCtorSignature = { typeof(object), typeof(IntPtr) };
@@ -55,26 +56,23 @@ namespace UnrealEngine.Framework {
 				int head = 0;
 				IntPtr* assertFunctions = (IntPtr*)buffer[position++];
 
-				Assert.outputMessage = (delegate* unmanaged[Cdecl]<byte[], void>)assertFunctions[head++];
+				Assert.outputMessage = (delegate* unmanaged[Cdecl]<byte*, void>)assertFunctions[head++];
 			}
 
 			unchecked {
 				int head = 0;
 				IntPtr* commandLineFunctions = (IntPtr*)buffer[position++];
 
-				CommandLine.get = (delegate* unmanaged[Cdecl]<byte[], void>)commandLineFunctions[head++];
-				CommandLine.set = (delegate* unmanaged[Cdecl]<byte[], void>)commandLineFunctions[head++];
-				CommandLine.append = (delegate* unmanaged[Cdecl]<byte[], void>)commandLineFunctions[head++];
+				CommandLine.set = (delegate* unmanaged[Cdecl]<byte*, void>)commandLineFunctions[head++];
+				CommandLine.append = (delegate* unmanaged[Cdecl]<byte*, void>)commandLineFunctions[head++];
 			}
 
 			unchecked {
 				int head = 0;
 				IntPtr* debugFunctions = (IntPtr*)buffer[position++];
 
-				Debug.log = (delegate* unmanaged[Cdecl]<LogLevel, byte[], void>)debugFunctions[head++];
-				Debug.exception = (delegate* unmanaged[Cdecl]<byte[], void>)debugFunctions[head++];
-				Debug.addOnScreenMessage = (delegate* unmanaged[Cdecl]<int, float, int, byte[], void>)debugFunctions[head++];
-				Debug.clearOnScreenMessages = (delegate* unmanaged[Cdecl]<void>)debugFunctions[head++];
+				Debug.log = (delegate* unmanaged[Cdecl]<LogLevel, byte*, void>)debugFunctions[head++];
+				Debug.exception = (delegate* unmanaged[Cdecl]<byte*, void>)debugFunctions[head++];
 			}
 
             unchecked
@@ -82,18 +80,135 @@ namespace UnrealEngine.Framework {
                 int head = 0;
                 IntPtr* applicationFunctions = (IntPtr*)buffer[position++];
 
-                Application.isCanEverRender = (delegate* unmanaged[Cdecl]<Bool>)applicationFunctions[head++];
-                Application.isPackagedForDistribution = (delegate* unmanaged[Cdecl]<Bool>)applicationFunctions[head++];
-                Application.isPackagedForShipping = (delegate* unmanaged[Cdecl]<Bool>)applicationFunctions[head++];
-                Application.getProjectDirectory = (delegate* unmanaged[Cdecl]<byte[], void>)applicationFunctions[head++];
-                Application.getDefaultLanguage = (delegate* unmanaged[Cdecl]<byte[], void>)applicationFunctions[head++];
-                Application.getProjectName = (delegate* unmanaged[Cdecl]<byte[], void>)applicationFunctions[head++];
+                Application.getEnvironment = (delegate* unmanaged[Cdecl]<IntPtr>)applicationFunctions[head++];
+                Application.getInteropCalls = (delegate* unmanaged[Cdecl]<long>)applicationFunctions[head++];
                 Application.getVolumeMultiplier = (delegate* unmanaged[Cdecl]<float>)applicationFunctions[head++];
-                Application.setProjectName = (delegate* unmanaged[Cdecl]<byte[], void>)applicationFunctions[head++];
+                Application.setProjectName = (delegate* unmanaged[Cdecl]<byte*, void>)applicationFunctions[head++];
                 Application.setVolumeMultiplier = (delegate* unmanaged[Cdecl]<float, void>)applicationFunctions[head++];
-                Application.requestExit = (delegate* unmanaged[Cdecl]<Bool, void>)applicationFunctions[head++];
+                Application.requestExit = (delegate* unmanaged[Cdecl]<Bool, int, void>)applicationFunctions[head++];
             }
 
+			unchecked {
+				int head = 0;
+				IntPtr* worldFunctions = (IntPtr*)buffer[position++];
+
+				World.traceBatch = (delegate* unmanaged[Cdecl]<TraceQuery*, Hit*, int, int>)worldFunctions[head++];
+				World.submitTraceBatch = (delegate* unmanaged[Cdecl]<TraceQuery*, Hit*, int, int>)worldFunctions[head++];
+				World.queryTraceBatch = (delegate* unmanaged[Cdecl]<int, int>)worldFunctions[head++];
+				World.subscribe = (delegate* unmanaged[Cdecl]<TickGroup, IntPtr, int, int>)worldFunctions[head++];
+				World.unsubscribe = (delegate* unmanaged[Cdecl]<int, void>)worldFunctions[head++];
+				World.getSubscriberStates = (delegate* unmanaged[Cdecl]<int*>)worldFunctions[head++];
+				World.setFixedStep = (delegate* unmanaged[Cdecl]<TickGroup, IntPtr, float, int, IntPtr*, Bool>)worldFunctions[head++];
+				World.getInterpolationAlpha = (delegate* unmanaged[Cdecl]<TickGroup, float>)worldFunctions[head++];
+				World.findActor = (delegate* unmanaged[Cdecl]<byte*, IntPtr>)worldFunctions[head++];
+				World.findActorByTag = (delegate* unmanaged[Cdecl]<byte*, IntPtr>)worldFunctions[head++];
+				World.findActorByID = (delegate* unmanaged[Cdecl]<uint, IntPtr>)worldFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* tickFunctionFunctions = (IntPtr*)buffer[position++];
+
+				TickFunction.create = (delegate* unmanaged[Cdecl]<TickGroup, IntPtr, float, int>)tickFunctionFunctions[head++];
+				TickFunction.destroy = (delegate* unmanaged[Cdecl]<int, void>)tickFunctionFunctions[head++];
+				TickFunction.setEnabled = (delegate* unmanaged[Cdecl]<int, Bool, void>)tickFunctionFunctions[head++];
+				TickFunction.setInterval = (delegate* unmanaged[Cdecl]<int, float, void>)tickFunctionFunctions[head++];
+				TickFunction.addPrerequisite = (delegate* unmanaged[Cdecl]<int, IntPtr, void>)tickFunctionFunctions[head++];
+				TickFunction.addTickFunctionPrerequisite = (delegate* unmanaged[Cdecl]<int, int, void>)tickFunctionFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* timerFunctions = (IntPtr*)buffer[position++];
+
+				TimerWheel.setHandler = (delegate* unmanaged[Cdecl]<IntPtr, void>)timerFunctions[head++];
+				TimerWheel.schedule = (delegate* unmanaged[Cdecl]<float, float, int, int>)timerFunctions[head++];
+				TimerWheel.cancel = (delegate* unmanaged[Cdecl]<int, Bool>)timerFunctions[head++];
+				TimerWheel.isScheduled = (delegate* unmanaged[Cdecl]<int, Bool>)timerFunctions[head++];
+				TimerWheel.getRemaining = (delegate* unmanaged[Cdecl]<int, float>)timerFunctions[head++];
+				TimerWheel.getCount = (delegate* unmanaged[Cdecl]<int>)timerFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* functionHandleFunctions = (IntPtr*)buffer[position++];
+
+				FunctionHandle.resolve = (delegate* unmanaged[Cdecl]<IntPtr, byte*, int*, int>)functionHandleFunctions[head++];
+				FunctionHandle.getParameters = (delegate* unmanaged[Cdecl]<int, byte*>)functionHandleFunctions[head++];
+				FunctionHandle.getParameterOffset = (delegate* unmanaged[Cdecl]<int, byte*, int>)functionHandleFunctions[head++];
+				FunctionHandle.invoke = (delegate* unmanaged[Cdecl]<int, IntPtr, Bool>)functionHandleFunctions[head++];
+				FunctionHandle.release = (delegate* unmanaged[Cdecl]<int, void>)functionHandleFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* actorQueryFunctions = (IntPtr*)buffer[position++];
+
+				ActorQuery.create = (delegate* unmanaged[Cdecl]<ActorQuery.Description*, int>)actorQueryFunctions[head++];
+				ActorQuery.update = (delegate* unmanaged[Cdecl]<int, int*, ObjectReference*>)actorQueryFunctions[head++];
+				ActorQuery.release = (delegate* unmanaged[Cdecl]<int, void>)actorQueryFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* splineFunctions = (IntPtr*)buffer[position++];
+
+				Spline.sample = (delegate* unmanaged[Cdecl]<IntPtr, float*, int, SplineSampleMode, SplineCoordinateSpace, Vector3*, Vector3*, Quaternion*, Transform*, Bool>)splineFunctions[head++];
+				Spline.setPoints = (delegate* unmanaged[Cdecl]<IntPtr, Vector3*, Vector3*, int, SplineCoordinateSpace, Bool>)splineFunctions[head++];
+				Spline.updatePoints = (delegate* unmanaged[Cdecl]<IntPtr, int*, Vector3*, Vector3*, int, SplineCoordinateSpace, Bool>)splineFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* animationBindingFunctions = (IntPtr*)buffer[position++];
+
+				AnimationBinding.create = (delegate* unmanaged[Cdecl]<byte**, int, byte**, int, int>)animationBindingFunctions[head++];
+				AnimationBinding.read = (delegate* unmanaged[Cdecl]<int, ObjectReference*, int, float*, float*, int>)animationBindingFunctions[head++];
+				AnimationBinding.write = (delegate* unmanaged[Cdecl]<int, ObjectReference*, int, float*, int>)animationBindingFunctions[head++];
+				AnimationBinding.release = (delegate* unmanaged[Cdecl]<int, void>)animationBindingFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* inputFunctions = (IntPtr*)buffer[position++];
+
+				InputEvents.setHandler = (delegate* unmanaged[Cdecl]<IntPtr, void>)inputFunctions[head++];
+				InputEvents.setTickGroup = (delegate* unmanaged[Cdecl]<TickGroup, Bool>)inputFunctions[head++];
+				InputEvents.bindAction = (delegate* unmanaged[Cdecl]<byte*, int>)inputFunctions[head++];
+				InputEvents.bindAxis = (delegate* unmanaged[Cdecl]<byte*, int>)inputFunctions[head++];
+				InputEvents.unbind = (delegate* unmanaged[Cdecl]<int, Bool>)inputFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* texturePixelsFunctions = (IntPtr*)buffer[position++];
+
+				TexturePixels.setHandler = (delegate* unmanaged[Cdecl]<IntPtr, void>)texturePixelsFunctions[head++];
+				TexturePixels.lockMip = (delegate* unmanaged[Cdecl]<IntPtr, int, int*, int*, int*, byte*>)texturePixelsFunctions[head++];
+				TexturePixels.unlockMip = (delegate* unmanaged[Cdecl]<IntPtr, int, Bool, Bool>)texturePixelsFunctions[head++];
+				TexturePixels.updateRegions = (delegate* unmanaged[Cdecl]<IntPtr, int, TextureRegion*, int, int, int, byte*, int, Bool>)texturePixelsFunctions[head++];
+			}
+
+			unchecked {
+				int head = 0;
+				IntPtr* memoryFunctions = (IntPtr*)buffer[position++];
+
+				Memory.getFrameArena = (delegate* unmanaged[Cdecl]<IntPtr>)memoryFunctions[head++];
+				Memory.getMutationQueue = (delegate* unmanaged[Cdecl]<IntPtr>)memoryFunctions[head++];
+				Memory.setMutationHandler = (delegate* unmanaged[Cdecl]<IntPtr, void>)memoryFunctions[head++];
+				Memory.getDebugDraw = (delegate* unmanaged[Cdecl]<IntPtr>)memoryFunctions[head++];
+				Memory.isInGameThread = (delegate* unmanaged[Cdecl]<Bool>)memoryFunctions[head++];
+			}
+
+			FrameArena.Initialize(Memory.getFrameArena());
+			Environment.Initialize(Application.getEnvironment());
+			World.subscriberStates = World.getSubscriberStates();
+			TimerWheel.Initialize();
+			InputEvents.Initialize();
+			TexturePixels.Initialize();
+			MutationQueue.Initialize(Memory.getMutationQueue());
+			Debug.Initialize(Memory.getDebugDraw());
+
             unchecked {
 				Type[] types = pluginAssembly.GetTypes();
 
@@ -192,9 +307,6 @@ namespace UnrealEngine.Framework {
 
             Directory.SetCurrentDirectory(Application.ProjectDirectory);
 
-			GC.Collect();
-			GC.WaitForPendingFinalizers();
-
 			return userFunctions;
 		}
 
@@ -234,6 +346,8 @@ namespace UnrealEngine.Framework {
 			string methodName = $"{ method.DeclaringType.FullName }.{ method.Name }";
 
 			Delegate dynamicDelegate = delegatesCache.GetOrAdd(methodName, () => {
+				entryPoints.Add(method);
+
 				ParameterInfo[] parameterInfos = method.GetParameters();
 				Type[] parameterTypes = new Type[parameterInfos.Length];
 
@@ -261,38 +375,113 @@ namespace UnrealEngine.Framework {
 	}
 
 	static unsafe partial class Assert {
-		internal static delegate* unmanaged[Cdecl]<byte[], void> outputMessage;
+		internal static delegate* unmanaged[Cdecl]<byte*, void> outputMessage;
 	}
 
 	static unsafe partial class CommandLine {
-		internal static delegate* unmanaged[Cdecl]<byte[], void> get;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> set;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> append;
+		internal static delegate* unmanaged[Cdecl]<byte*, void> set;
+		internal static delegate* unmanaged[Cdecl]<byte*, void> append;
 	}
 
 	static unsafe partial class Debug {
-		internal static delegate* unmanaged[Cdecl]<LogLevel, byte[], void> log;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> exception;
-		internal static delegate* unmanaged[Cdecl]<int, float, int, byte[], void> addOnScreenMessage;
-		internal static delegate* unmanaged[Cdecl]<void> clearOnScreenMessages;
+		internal static delegate* unmanaged[Cdecl]<LogLevel, byte*, void> log;
+		internal static delegate* unmanaged[Cdecl]<byte*, void> exception;
 	}
 
 	static unsafe partial class Application {
-		internal static delegate* unmanaged[Cdecl]<Bool> isCanEverRender;
-		internal static delegate* unmanaged[Cdecl]<Bool> isPackagedForDistribution;
-		internal static delegate* unmanaged[Cdecl]<Bool> isPackagedForShipping;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> getProjectDirectory;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> getDefaultLanguage;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> getProjectName;
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getEnvironment;
+		internal static delegate* unmanaged[Cdecl]<long> getInteropCalls;
 		internal static delegate* unmanaged[Cdecl]<float> getVolumeMultiplier;
-		internal static delegate* unmanaged[Cdecl]<byte[], void> setProjectName;
+		internal static delegate* unmanaged[Cdecl]<byte*, void> setProjectName;
 		internal static delegate* unmanaged[Cdecl]<float, void> setVolumeMultiplier;
-		internal static delegate* unmanaged[Cdecl]<Bool, void> requestExit;
+		internal static delegate* unmanaged[Cdecl]<Bool, int, void> requestExit;
+	}
+
+	static unsafe partial class World {
+		internal static delegate* unmanaged[Cdecl]<TraceQuery*, Hit*, int, int> traceBatch;
+		internal static delegate* unmanaged[Cdecl]<TraceQuery*, Hit*, int, int> submitTraceBatch;
+		internal static delegate* unmanaged[Cdecl]<int, int> queryTraceBatch;
+		internal static delegate* unmanaged[Cdecl]<TickGroup, IntPtr, int, int> subscribe;
+		internal static delegate* unmanaged[Cdecl]<int, void> unsubscribe;
+		internal static delegate* unmanaged[Cdecl]<int*> getSubscriberStates;
+		internal static delegate* unmanaged[Cdecl]<TickGroup, IntPtr, float, int, IntPtr*, Bool> setFixedStep;
+		internal static delegate* unmanaged[Cdecl]<TickGroup, float> getInterpolationAlpha;
+		internal static delegate* unmanaged[Cdecl]<byte*, IntPtr> findActor;
+		internal static delegate* unmanaged[Cdecl]<byte*, IntPtr> findActorByTag;
+		internal static delegate* unmanaged[Cdecl]<uint, IntPtr> findActorByID;
+	}
+
+	unsafe partial class TickFunction {
+		internal static delegate* unmanaged[Cdecl]<TickGroup, IntPtr, float, int> create;
+		internal static delegate* unmanaged[Cdecl]<int, void> destroy;
+		internal static delegate* unmanaged[Cdecl]<int, Bool, void> setEnabled;
+		internal static delegate* unmanaged[Cdecl]<int, float, void> setInterval;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, void> addPrerequisite;
+		internal static delegate* unmanaged[Cdecl]<int, int, void> addTickFunctionPrerequisite;
+	}
+
+	static unsafe partial class TimerWheel {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setHandler;
+		internal static delegate* unmanaged[Cdecl]<float, float, int, int> schedule;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> cancel;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> isScheduled;
+		internal static delegate* unmanaged[Cdecl]<int, float> getRemaining;
+		internal static delegate* unmanaged[Cdecl]<int> getCount;
+	}
+
+	unsafe partial class FunctionHandle {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, byte*, int*, int> resolve;
+		internal static delegate* unmanaged[Cdecl]<int, byte*> getParameters;
+		internal static delegate* unmanaged[Cdecl]<int, byte*, int> getParameterOffset;
+		internal static delegate* unmanaged[Cdecl]<int, IntPtr, Bool> invoke;
+		internal static delegate* unmanaged[Cdecl]<int, void> release;
+	}
+
+	unsafe partial class ActorQuery {
+		internal static delegate* unmanaged[Cdecl]<Description*, int> create;
+		internal static delegate* unmanaged[Cdecl]<int, int*, ObjectReference*> update;
+		internal static delegate* unmanaged[Cdecl]<int, void> release;
+	}
+
+	static unsafe partial class Spline {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, float*, int, SplineSampleMode, SplineCoordinateSpace, Vector3*, Vector3*, Quaternion*, Transform*, Bool> sample;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, Vector3*, Vector3*, int, SplineCoordinateSpace, Bool> setPoints;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, int*, Vector3*, Vector3*, int, SplineCoordinateSpace, Bool> updatePoints;
+	}
+
+	unsafe partial class AnimationBinding {
+		internal static delegate* unmanaged[Cdecl]<byte**, int, byte**, int, int> create;
+		internal static delegate* unmanaged[Cdecl]<int, ObjectReference*, int, float*, float*, int> read;
+		internal static delegate* unmanaged[Cdecl]<int, ObjectReference*, int, float*, int> write;
+		internal static delegate* unmanaged[Cdecl]<int, void> release;
+	}
+
+	static unsafe partial class InputEvents {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setHandler;
+		internal static delegate* unmanaged[Cdecl]<TickGroup, Bool> setTickGroup;
+		internal static delegate* unmanaged[Cdecl]<byte*, int> bindAction;
+		internal static delegate* unmanaged[Cdecl]<byte*, int> bindAxis;
+		internal static delegate* unmanaged[Cdecl]<int, Bool> unbind;
+	}
+
+	static unsafe partial class TexturePixels {
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setHandler;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, int, int*, int*, int*, byte*> lockMip;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, int, Bool, Bool> unlockMip;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, int, TextureRegion*, int, int, int, byte*, int, Bool> updateRegions;
+	}
+
+	internal static unsafe class Memory {
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getFrameArena;
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getMutationQueue;
+		internal static delegate* unmanaged[Cdecl]<IntPtr, void> setMutationHandler;
+		internal static delegate* unmanaged[Cdecl]<IntPtr> getDebugDraw;
+		internal static delegate* unmanaged[Cdecl]<Bool> isInGameThread;
 	}
     internal static unsafe class Object
     {
         internal static delegate* unmanaged[Cdecl]<IntPtr, Bool> isValid;
         internal static delegate* unmanaged[Cdecl]<IntPtr, uint> getID;
-        internal static delegate* unmanaged[Cdecl]<IntPtr, byte[], void> getName;
+        internal static delegate* unmanaged[Cdecl]<IntPtr, byte*> getName;
     }
 }
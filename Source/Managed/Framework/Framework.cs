@@ -22,6 +22,7 @@
  */
 
 using System;
+using System.Buffers;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Drawing;
@@ -31,26 +32,14 @@ using System.Numerics;
 using System.Reflection;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
+using System.Runtime.Loader;
 using System.Runtime.Serialization;
 using System.Text;
+using System.Threading;
 
 namespace UnrealEngine.Framework {
 	// Internal
 
-	internal static class ArrayPool {
-		[ThreadStatic]
-		private static byte[] stringBuffer;
-
-		public static byte[] GetStringBuffer() {
-			if (stringBuffer == null)
-				stringBuffer = GC.AllocateUninitializedArray<byte>(8192, pinned: true);
-
-			Array.Clear(stringBuffer, 0, stringBuffer.Length);
-
-			return stringBuffer;
-		}
-	}
-
 	internal static class Collector {
 		[ThreadStatic]
 		private static List<object> references;
@@ -65,30 +54,133 @@ namespace UnrealEngine.Framework {
 		}
 	}
 
-	internal static class Extensions {
-		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		internal static T GetOrAdd<S, T>(this IDictionary<S, T> dictionary, S key, Func<T> valueCreator) => dictionary.TryGetValue(key, out var value) ? value : dictionary[key] = valueCreator();
+	internal static unsafe class Environment {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Argument {
+			internal byte* key;
+			internal byte* value;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Block {
+			internal int version;
+			internal Bool isCanEverRender;
+			internal Bool isPackagedForDistribution;
+			internal Bool isPackagedForShipping;
+			internal byte* projectDirectory;
+			internal byte* defaultLanguage;
+			internal byte* projectName;
+			internal byte* commandLine;
+			internal Argument* arguments;
+			internal int argumentsCount;
+		}
+
+		private static Block* block;
+		private static int version;
+		private static string projectDirectory;
+		private static string defaultLanguage;
+		private static string projectName;
+		private static string commandLine;
+		private static Dictionary<string, string> arguments;
+
+		internal static void Initialize(IntPtr pointer) {
+			block = (Block*)pointer;
+			version = 0;
+		}
+
+		internal static bool IsCanEverRender => block->isCanEverRender;
+
+		internal static bool IsPackagedForDistribution => block->isPackagedForDistribution;
+
+		internal static bool IsPackagedForShipping => block->isPackagedForShipping;
+
+		internal static string ProjectDirectory {
+			get {
+				Update();
+
+				return projectDirectory;
+			}
+		}
+
+		internal static string DefaultLanguage {
+			get {
+				Update();
+
+				return defaultLanguage;
+			}
+		}
+
+		internal static string ProjectName {
+			get {
+				Update();
+
+				return projectName;
+			}
+		}
+
+		internal static string CommandLine {
+			get {
+				Update();
+
+				return commandLine;
+			}
+		}
+
+		internal static Dictionary<string, string> Arguments {
+			get {
+				Update();
+
+				return arguments;
+			}
+		}
 
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		internal static byte[] StringToBytes(this string value) {
-			if (value != null)
-				return Encoding.UTF8.GetBytes(value);
+		private static void Update() {
+			if (Volatile.Read(ref block->version) != version)
+				Decode();
+		}
 
-			return null;
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static void Decode() {
+			int currentVersion = Volatile.Read(ref block->version);
+			Dictionary<string, string> currentArguments = new(block->argumentsCount, StringComparer.OrdinalIgnoreCase);
+
+			for (int i = 0; i < block->argumentsCount; i++) {
+				currentArguments[Extensions.BytesToString(block->arguments[i].key)] = Extensions.BytesToString(block->arguments[i].value);
+			}
+
+			projectDirectory = Extensions.BytesToString(block->projectDirectory);
+			defaultLanguage = Extensions.BytesToString(block->defaultLanguage);
+			projectName = Extensions.BytesToString(block->projectName);
+			commandLine = Extensions.BytesToString(block->commandLine);
+			arguments = currentArguments;
+			version = currentVersion;
 		}
+	}
 
+	internal static unsafe class Extensions {
 		[MethodImpl(MethodImplOptions.AggressiveInlining)]
-		internal static string BytesToString(this byte[] buffer) {
-			int end;
+		internal static T GetOrAdd<S, T>(this IDictionary<S, T> dictionary, S key, Func<T> valueCreator) => dictionary.TryGetValue(key, out var value) ? value : dictionary[key] = valueCreator();
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static byte* StringToBytes(this string value) {
+			if (value == null)
+				return null;
 
-			for (end = 0; end < buffer.Length && buffer[end] != 0; end++);
+			int length = Encoding.UTF8.GetByteCount(value);
+			byte* buffer = FrameArena.Allocate(length + 1);
 
-			unsafe {
-				fixed (byte* pinnedBuffer = buffer) {
-					return new((sbyte*)pinnedBuffer, 0, end);
-				}
+			fixed (char* characters = value) {
+				Encoding.UTF8.GetBytes(characters, value.Length, buffer, length);
 			}
+
+			buffer[length] = 0;
+
+			return buffer;
 		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static string BytesToString(byte* buffer) => Marshal.PtrToStringUTF8((IntPtr)buffer);
 	}
 
 	internal static class Tables {
@@ -152,253 +244,2505 @@ namespace UnrealEngine.Framework {
 	// Public
 
 	/// <summary>
-	/// Defines the log level for an output log message
+	/// Per-frame linear memory shared with the engine for transient interop data, reset by the plugin after <c>OnWorldPostUpdateTick</c>
 	/// </summary>
-	public enum LogLevel : int {
-		/// <summary>
-		/// Logs are printed to console and log files
-		/// </summary>
-		Display,
+	public static unsafe class FrameArena {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Arena {
+			internal byte* buffer;
+			internal long capacity;
+			internal long offset;
+			internal long highWaterMark;
+			internal int generation;
+			internal int overflows;
+		}
+
+		private static Arena* arena;
+		[ThreadStatic]
+		private static List<byte[]> overflowBuffers;
+		[ThreadStatic]
+		private static int overflowGeneration;
+		[ThreadStatic]
+		private static int threadAffinity;
+
 		/// <summary>
-		/// Logs are printed to console and log files with the yellow color
+		/// Returns the size of the arena in bytes
 		/// </summary>
-		Warning,
+		public static long Capacity => arena->capacity;
+
 		/// <summary>
-		/// Logs are printed to console and log files with the red color
+		/// Returns the number of bytes allocated in the current frame
 		/// </summary>
-		Error,
+		public static long Used => Math.Min(Volatile.Read(ref arena->offset), arena->capacity);
+
 		/// <summary>
-		/// Logs are printed to console and log files then crashes the application even if logging is disabled
+		/// Returns the maximum number of bytes requested in a single frame since the start of the application
 		/// </summary>
-		Fatal
-	}
+		public static long HighWaterMark => arena->highWaterMark;
 
-	/// <summary>
-	/// Functionality to work with the command-line of the engine executable
-	/// </summary>
-	public static unsafe partial class CommandLine {
 		/// <summary>
-		/// Returns the user arguments
+		/// Allocates uninitialized memory that is valid until the end of the current frame, falls back to the pinned managed heap when the arena is exhausted
 		/// </summary>
-		public static string Get() {
-			byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		/// <remarks>The arena is reset by the game thread, so other threads always allocate from the pinned managed heap</remarks>
+		public static Span<T> Allocate<T>(int length) where T : unmanaged {
+			ArgumentOutOfRangeException.ThrowIfNegative(length);
 
-			get(stringBuffer);
-
-			return stringBuffer.BytesToString();
+			return new(Allocate(checked(length * sizeof(T))), length);
 		}
 
-		/// <summary>
-		/// Overrides the arguments
-		/// </summary>
-		public static void Set(string arguments) {
-			if (arguments == null)
-				throw new ArgumentNullException(nameof(arguments));
+		internal static void Initialize(IntPtr pointer) {
+			if (arena != null)
+				return;
 
-			set(arguments.StringToBytes());
-		}
+			arena = (Arena*)pointer;
 
-		/// <summary>
-		/// Appends the string to the arguments as it is without adding a space
-		/// </summary>
-		public static void Append(string arguments) {
-			if (arguments == null)
-				throw new ArgumentNullException(nameof(arguments));
+			long capacity = arena->capacity;
 
-			append(arguments.StringToBytes());
+			if (capacity <= 0)
+				return;
+
+			GC.AddMemoryPressure(capacity);
+
+			AssemblyLoadContext.GetLoadContext(typeof(FrameArena).Assembly).Unloading += context => GC.RemoveMemoryPressure(capacity);
 		}
-	}
 
-	/// <summary>
-	/// Functionality for debugging
-	/// </summary>
-	public static unsafe partial class Debug {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new(8192);
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static byte* Allocate(int size) {
+			if (!IsGameThread)
+				return AllocateOverflow(size);
 
-		/// <summary>
-		/// Logs a message in accordance to the specified level, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
-		/// </summary>
-		public static void Log(LogLevel level, string message) {
-			if (message == null)
-				throw new ArgumentNullException(nameof(message));
+			long alignedSize = (size + 7) & ~7L;
+			long offset = Interlocked.Add(ref arena->offset, alignedSize) - alignedSize;
 
-			log(level, message.StringToBytes());
-		}
+			if (offset + alignedSize <= arena->capacity)
+				return arena->buffer + offset;
 
-		/// <summary>
-		/// Creates a log file with the name of assembly if required and writes an exception to it, prints it on the screen, printing on the screen is omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration, but log file will persist
-		/// </summary>
-		public static void Exception(Exception exception) {
-			if (exception == null)
-				throw new ArgumentNullException(nameof(exception));
+			Interlocked.Increment(ref arena->overflows);
 
-			stringBuffer.Clear()
-			.AppendFormat("Time: {0}", DateTime.Now.ToString("dd/MM/yyyy hh:mm:ss tt"))
-			.AppendLine().AppendFormat("Message: {0}", exception.Message)
-			.AppendLine().AppendFormat("StackTrace: {0}", exception.StackTrace)
-			.AppendLine().AppendFormat("Source: {0}", exception.Source)
-			.AppendLine();
+			return AllocateOverflow(size);
+		}
 
-			Debug.exception(stringBuffer.ToString().StringToBytes());
+		private static bool IsGameThread {
+			[MethodImpl(MethodImplOptions.AggressiveInlining)]
+			get {
+				// Resolved once per thread by the engine, since the framework is initialized on the boot thread
 
-			using (StreamWriter streamWriter = File.AppendText(Application.ProjectDirectory + "Saved/Logs/Exceptions-" + Assembly.GetCallingAssembly().GetName().Name + ".log")) {
-				streamWriter.WriteLine(stringBuffer);
-				streamWriter.Close();
+				if (threadAffinity == 0)
+					threadAffinity = Memory.isInGameThread() ? 1 : -1;
+
+				return threadAffinity > 0;
 			}
 		}
 
-		/// <summary>
-		/// Prints a debug message on the screen assigned to the key identifier, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
-		/// </summary>
-		public static void AddOnScreenMessage(int key, float timeToDisplay, Color displayColor, string message) {
-			if (message == null)
-				throw new ArgumentNullException(nameof(message));
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static byte* AllocateOverflow(int size) {
+			if (overflowBuffers == null)
+				overflowBuffers = new();
 
-			addOnScreenMessage(key, timeToDisplay, displayColor.ToArgb(), message.StringToBytes());
-		}
+			if (overflowGeneration != arena->generation) {
+				overflowBuffers.Clear();
+				overflowGeneration = arena->generation;
+			}
 
-		/// <summary>
-		/// Clears any existing debug messages, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
-		/// </summary>
-		public static void ClearOnScreenMessages() => clearOnScreenMessages();
+			byte[] buffer = GC.AllocateUninitializedArray<byte>(size, pinned: true);
+
+			overflowBuffers.Add(buffer);
+
+			return (byte*)Unsafe.AsPointer(ref MemoryMarshal.GetArrayDataReference(buffer));
+		}
 	}
 
 	/// <summary>
-	/// Provides information about the application
+	/// A bounded lock-free queue shared with the engine that allows any managed thread to defer mutations of the engine to the game thread, queued mutations are executed in the order of publication once per frame in the tick group specified by the <c>clr.MutationQueue.TickGroup</c> console variable
 	/// </summary>
-	public static unsafe partial class Application {
-		/// <summary>
-		/// Returns <c>true</c> if the application can render anything
-		/// </summary>
-		public static bool IsCanEverRender => isCanEverRender();
+	public static unsafe class MutationQueue {
+		[StructLayout(LayoutKind.Explicit)]
+		private struct Entry {
+			[FieldOffset(0)]
+			internal long sequence;
+			[FieldOffset(8)]
+			internal IntPtr dispatcher;
+			[FieldOffset(16)]
+			internal IntPtr function;
+			[FieldOffset(24)]
+			internal long timestamp;
+			[FieldOffset(32)]
+			internal int context;
+			[FieldOffset(40)]
+			internal fixed byte payload[payloadSize];
+		}
 
-		/// <summary>
-		/// Returns <c>true</c> if current build is meant for release to retail
-		/// </summary>
-		public static bool IsPackagedForDistribution => isPackagedForDistribution();
+		[StructLayout(LayoutKind.Explicit)]
+		private struct Queue {
+			[FieldOffset(0)]
+			internal Entry* entries;
+			[FieldOffset(8)]
+			internal long capacity;
+			[FieldOffset(16)]
+			internal int stalls;
+			[FieldOffset(20)]
+			internal int context;
+			[FieldOffset(64)]
+			internal long enqueuePosition;
+			[FieldOffset(128)]
+			internal long dequeuePosition;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Batch {
+			internal long position;
+			internal int count;
+			internal int processed;
+			internal float latency;
+			internal int context;
+		}
+
+		private delegate void DrainHandler(IntPtr batch);
+
+		private const int payloadSize = 32;
+		private static readonly DrainHandler drainer = Drain;
+		private static Queue* queue;
+		private static int gameThreadId;
 
 		/// <summary>
-		/// Returns <c>true</c> if current build is packaged for shipping
+		/// Returns the maximum number of mutations that can be queued
 		/// </summary>
-		public static bool IsPackagedForShipping => isPackagedForShipping();
+		public static int Capacity => (int)queue->capacity;
 
 		/// <summary>
-		/// Returns the project directory
+		/// Returns the number of queued mutations that are not executed yet
 		/// </summary>
-		public static string ProjectDirectory {
-			get {
-				byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		public static int Count => (int)Math.Clamp(Volatile.Read(ref queue->enqueuePosition) - Volatile.Read(ref queue->dequeuePosition), 0, queue->capacity);
 
-				getProjectDirectory(stringBuffer);
+		internal static void Initialize(IntPtr pointer) {
+			queue = (Queue*)pointer;
+			gameThreadId = System.Environment.CurrentManagedThreadId;
 
-				return stringBuffer.BytesToString();
-			}
+			Memory.setMutationHandler(Marshal.GetFunctionPointerForDelegate(drainer));
 		}
 
 		/// <summary>
-		/// Returns the default language used by current platform
+		/// Attempts to queue a static method with its state for execution on the game thread, returns <c>false</c> if the queue is full
 		/// </summary>
-		public static string DefaultLanguage {
-			get {
-				byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		/// <remarks>The state is copied into the queue and limited to 32 bytes</remarks>
+		public static bool TryEnqueue<T>(delegate*<T, void> mutation, T state) where T : unmanaged {
+			ArgumentNullException.ThrowIfNull(mutation);
 
-				getDefaultLanguage(stringBuffer);
+			if (sizeof(T) > payloadSize)
+				throw new ArgumentException("Size of the state exceeds " + payloadSize + " bytes", nameof(state));
 
-				return stringBuffer.BytesToString();
-			}
+			delegate*<IntPtr, byte*, void> dispatcher = &Dispatch<T>;
+
+			return Publish((IntPtr)dispatcher, (IntPtr)mutation, (byte*)&state, sizeof(T));
 		}
 
 		/// <summary>
-		/// Gets or sets the name of the current project
+		/// Queues a static method with its state for execution on the game thread, blocks the calling thread while the queue is full, a mutation queued from the game thread to the full queue is executed immediately
 		/// </summary>
-		public static string ProjectName {
-			get {
-				byte[] stringBuffer = ArrayPool.GetStringBuffer();
+		/// <remarks>The state is copied into the queue and limited to 32 bytes</remarks>
+		public static void Enqueue<T>(delegate*<T, void> mutation, T state) where T : unmanaged {
+			if (TryEnqueue(mutation, state))
+				return;
 
-				getProjectName(stringBuffer);
+			Interlocked.Increment(ref queue->stalls);
 
-				return stringBuffer.BytesToString();
+			if (System.Environment.CurrentManagedThreadId == gameThreadId) {
+				mutation(state);
+
+				return;
 			}
 
-			set {
-				setProjectName(value.StringToBytes());
+			SpinWait spinWait = default;
+
+			while (!TryEnqueue(mutation, state)) {
+				spinWait.SpinOnce();
 			}
 		}
 
-		/// <summary>
-		/// Gets or sets the current volume multiplier
-		/// </summary>
-		public static float VolumeMultiplier {
-			get => getVolumeMultiplier();
-			set => setVolumeMultiplier(value);
-		}
+		private static bool Publish(IntPtr dispatcher, IntPtr function, byte* payload, int size) {
+			long mask = queue->capacity - 1;
+			long position = Volatile.Read(ref queue->enqueuePosition);
 
-		/// <summary>
-		/// Requests application exit
-		/// </summary>
-		public static void RequestExit(bool force = false) => requestExit(force);
-	}
+			while (true) {
+				Entry* entry = queue->entries + (position & mask);
+				long difference = Volatile.Read(ref entry->sequence) - position;
 
-    /// <summary>
-    /// A representation of the engine's object reference
-    /// </summary>
-    [StructLayout(LayoutKind.Sequential)]
-    public unsafe struct ObjectReference : IEquatable<ObjectReference>
-    {
-        private IntPtr pointer;
+				if (difference == 0) {
+					long observed = Interlocked.CompareExchange(ref queue->enqueuePosition, position + 1, position);
 
-        internal IntPtr Pointer
-        {
-            get
-            {
-                if (!IsCreated)
-                    throw new InvalidOperationException();
+					if (observed == position) {
+						entry->dispatcher = dispatcher;
+						entry->function = function;
+						entry->timestamp = Stopwatch.GetTimestamp();
+						entry->context = Volatile.Read(ref queue->context);
 
-                return pointer;
-            }
+						Buffer.MemoryCopy(payload, entry->payload, payloadSize, size);
+						Volatile.Write(ref entry->sequence, position + 1);
 
-            set
-            {
-                if (value == IntPtr.Zero)
-                    throw new InvalidOperationException();
+						return true;
+					}
 
-                pointer = value;
-            }
-        }
+					position = observed;
+				} else if (difference < 0) {
+					return false;
+				} else {
+					position = Volatile.Read(ref queue->enqueuePosition);
+				}
+			}
+		}
 
-        /// <summary>
-        /// Tests for equality between two objects
-        /// </summary>
-        public static bool operator ==(ObjectReference left, ObjectReference right) => left.Equals(right);
+		private static void Dispatch<T>(IntPtr function, byte* payload) where T : unmanaged => ((delegate*<T, void>)function)(*(T*)payload);
 
-        /// <summary>
-        /// Tests for inequality between two objects
-        /// </summary>
-        public static bool operator !=(ObjectReference left, ObjectReference right) => !left.Equals(right);
+		private static void Drain(IntPtr batch) {
+			Batch* mutationBatch = (Batch*)batch;
+			long mask = queue->capacity - 1;
+			long timestamp = Stopwatch.GetTimestamp();
+			long latency = 0;
 
-        /// <summary>
-        /// Returns <c>true</c> if the object is created
-        /// </summary>
-        public bool IsCreated => pointer != IntPtr.Zero && Object.isValid(pointer);
+			for (int i = 0; i < mutationBatch->count; i++) {
+				Entry* entry = queue->entries + ((mutationBatch->position + i) & mask);
 
-        /// <summary>
-        /// Returns the unique ID of the object, reused by the engine, only unique while the object is alive
-        /// </summary>
-        public uint ID => Object.getID(Pointer);
+				if (entry->dispatcher != IntPtr.Zero && entry->context == mutationBatch->context)
+					latency = Math.Max(latency, timestamp - entry->timestamp);
+			}
 
-        /// <summary>
-        /// Returns the name of the object
-        /// </summary>
-        public string Name
-        {
-            get
-            {
-                byte[] stringBuffer = ArrayPool.GetStringBuffer();
+			mutationBatch->latency = (float)(latency * 1000.0 / Stopwatch.Frequency);
+
+			// Each mutation is cleared before execution so that a failed one is not executed again, mutations of other worlds are skipped
+
+			for (int i = 0; i < mutationBatch->count; i++) {
+				Entry* entry = queue->entries + ((mutationBatch->position + i) & mask);
+				IntPtr dispatcher = entry->dispatcher;
+
+				if (dispatcher == IntPtr.Zero || entry->context != mutationBatch->context)
+					continue;
 
-                Object.getName(Pointer, stringBuffer);
+				entry->dispatcher = IntPtr.Zero;
+				mutationBatch->processed++;
 
-                return stringBuffer.BytesToString();
+				((delegate*<IntPtr, byte*, void>)dispatcher)(entry->function, entry->payload);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Defines the log level for an output log message
+	/// </summary>
+	public enum LogLevel : int {
+		/// <summary>
+		/// Logs are printed to console and log files
+		/// </summary>
+		Display,
+		/// <summary>
+		/// Logs are printed to console and log files with the yellow color
+		/// </summary>
+		Warning,
+		/// <summary>
+		/// Logs are printed to console and log files with the red color
+		/// </summary>
+		Error,
+		/// <summary>
+		/// Logs are printed to console and log files then crashes the application even if logging is disabled
+		/// </summary>
+		Fatal
+	}
+
+	/// <summary>
+	/// Defines tick groups of the world that functions can be subscribed to
+	/// </summary>
+	public enum TickGroup : int {
+		/// <summary>
+		/// Executed at the beginning of the frame
+		/// </summary>
+		PrePhysics = 2,
+		/// <summary>
+		/// Executed when physics simulation has begun
+		/// </summary>
+		DuringPhysics = 3,
+		/// <summary>
+		/// Executed when physics simulation is complete
+		/// </summary>
+		PostPhysics = 4,
+		/// <summary>
+		/// Executed after cameras are updated
+		/// </summary>
+		PostUpdate = 5
+	}
+
+	/// <summary>
+	/// Defines collision channels
+	/// </summary>
+	public enum CollisionChannel : int {
+		/// <summary/>
+		WorldStatic,
+		/// <summary/>
+		WorldDynamic,
+		/// <summary/>
+		Pawn,
+		/// <summary/>
+		Visibility,
+		/// <summary/>
+		Camera,
+		/// <summary/>
+		PhysicsBody,
+		/// <summary/>
+		Vehicle,
+		/// <summary/>
+		Destructible,
+		/// <summary/>
+		EngineTraceChannel1,
+		/// <summary/>
+		EngineTraceChannel2,
+		/// <summary/>
+		EngineTraceChannel3,
+		/// <summary/>
+		EngineTraceChannel4,
+		/// <summary/>
+		EngineTraceChannel5,
+		/// <summary/>
+		EngineTraceChannel6,
+		/// <summary/>
+		GameTraceChannel1,
+		/// <summary/>
+		GameTraceChannel2,
+		/// <summary/>
+		GameTraceChannel3,
+		/// <summary/>
+		GameTraceChannel4,
+		/// <summary/>
+		GameTraceChannel5,
+		/// <summary/>
+		GameTraceChannel6,
+		/// <summary/>
+		GameTraceChannel7,
+		/// <summary/>
+		GameTraceChannel8,
+		/// <summary/>
+		GameTraceChannel9,
+		/// <summary/>
+		GameTraceChannel10,
+		/// <summary/>
+		GameTraceChannel11,
+		/// <summary/>
+		GameTraceChannel12,
+		/// <summary/>
+		GameTraceChannel13,
+		/// <summary/>
+		GameTraceChannel14,
+		/// <summary/>
+		GameTraceChannel15,
+		/// <summary/>
+		GameTraceChannel16,
+		/// <summary/>
+		GameTraceChannel17,
+		/// <summary/>
+		GameTraceChannel18
+	}
+
+	/// <summary>
+	/// Defines the shape type of a collision shape
+	/// </summary>
+	public enum CollisionShapeType : int {
+		/// <summary/>
+		Line,
+		/// <summary/>
+		Box,
+		/// <summary/>
+		Sphere,
+		/// <summary/>
+		Capsule
+	}
+
+	/// <summary>
+	/// Defines the coordinate space of spline points and samples
+	/// </summary>
+	public enum SplineCoordinateSpace : int {
+		/// <summary/>
+		Local,
+		/// <summary/>
+		World
+	}
+
+	/// <summary>
+	/// Defines how keys of spline samples are interpreted
+	/// </summary>
+	public enum SplineSampleMode : int {
+		/// <summary>
+		/// Keys are distances along the spline
+		/// </summary>
+		Distance,
+		/// <summary>
+		/// Keys are times within the duration of the spline, mapped to segments evenly
+		/// </summary>
+		Time,
+		/// <summary>
+		/// Keys are times within the duration of the spline, mapped to the length with constant velocity
+		/// </summary>
+		TimeWithConstantVelocity
+	}
+
+	/// <summary>
+	/// Defines the type of an input event
+	/// </summary>
+	public enum InputEventType : int {
+		/// <summary/>
+		Pressed,
+		/// <summary/>
+		Released,
+		/// <summary/>
+		Axis
+	}
+
+	/// <summary>
+	/// Functionality to work with the command-line of the engine executable
+	/// </summary>
+	public static unsafe partial class CommandLine {
+		/// <summary>
+		/// Returns the user arguments
+		/// </summary>
+		public static string Get() => Environment.CommandLine;
+
+		/// <summary>
+		/// Returns <c>true</c> if the switch such as <c>-nosound</c> or <c>-key=value</c> is passed, the name is case-insensitive and specified without a dash
+		/// </summary>
+		public static bool HasSwitch(string name) {
+			ArgumentNullException.ThrowIfNull(name);
+
+			return Environment.Arguments.ContainsKey(name);
+		}
+
+		/// <summary>
+		/// Retrieves the value of the switch passed as <c>-key=value</c> with quotes trimmed, the key is case-insensitive and specified without a dash
+		/// </summary>
+		public static bool TryGetValue(string key, out string value) {
+			ArgumentNullException.ThrowIfNull(key);
+
+			return Environment.Arguments.TryGetValue(key, out value) && value != null;
+		}
+
+		/// <summary>
+		/// Overrides the arguments
+		/// </summary>
+		public static void Set(string arguments) {
+			if (arguments == null)
+				throw new ArgumentNullException(nameof(arguments));
+
+			set(arguments.StringToBytes());
+		}
+
+		/// <summary>
+		/// Appends the string to the arguments as it is without adding a space
+		/// </summary>
+		public static void Append(string arguments) {
+			if (arguments == null)
+				throw new ArgumentNullException(nameof(arguments));
+
+			append(arguments.StringToBytes());
+		}
+	}
+
+	/// <summary>
+	/// Functionality for debugging
+	/// </summary>
+	public static unsafe partial class Debug {
+		private enum DrawType : int {
+			Line = 1,
+			Point,
+			Box,
+			Capsule,
+			Cone,
+			Cylinder,
+			Sphere,
+			Message,
+			ClearMessages,
+			FlushPersistentLines
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct DrawHeader {
+			internal DrawType type;
+			internal int size;
+			internal int context;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct DrawStyle {
+			internal int color;
+			internal float lifeTime;
+			internal float thickness;
+			internal byte depthPriority;
+			internal Bool persistent;
+
+			internal DrawStyle(Color color, bool persistentLines, float lifeTime, byte depthPriority, float thickness) {
+				this.color = color.ToArgb();
+				this.lifeTime = lifeTime;
+				this.thickness = thickness;
+				this.depthPriority = depthPriority;
+				persistent = persistentLines;
+			}
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Line {
+			internal DrawStyle style;
+			internal Vector3 start;
+			internal Vector3 end;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Point {
+			internal DrawStyle style;
+			internal Vector3 location;
+			internal float size;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Box {
+			internal DrawStyle style;
+			internal Vector3 center;
+			internal Vector3 extent;
+			internal Quaternion rotation;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Capsule {
+			internal DrawStyle style;
+			internal Vector3 center;
+			internal float halfHeight;
+			internal float radius;
+			internal Quaternion rotation;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Cone {
+			internal DrawStyle style;
+			internal Vector3 origin;
+			internal Vector3 direction;
+			internal float length;
+			internal float angleWidth;
+			internal float angleHeight;
+			internal int sides;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Cylinder {
+			internal DrawStyle style;
+			internal Vector3 start;
+			internal Vector3 end;
+			internal float radius;
+			internal int segments;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Sphere {
+			internal DrawStyle style;
+			internal Vector3 center;
+			internal float radius;
+			internal int segments;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Message {
+			internal int key;
+			internal float timeToDisplay;
+			internal int color;
+			internal int length;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct DrawBuffer {
+			internal byte* data;
+			internal long capacity;
+			internal long offset;
+			internal int writers;
+			internal int overflows;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct DrawBuffers {
+			internal DrawBuffer first;
+			internal DrawBuffer second;
+			internal int current;
+			internal int context;
+		}
+
+		private const int maxMessageLength = 4096;
+		private static DrawBuffers* drawBuffers;
+		[ThreadStatic]
+		private static StringBuilder stringBuffer = new(8192);
+
+		internal static void Initialize(IntPtr pointer) => drawBuffers = (DrawBuffers*)pointer;
+
+		private static DrawBuffer* Enter() {
+			// The buffer is re-checked after entering it since the engine may swap the buffers in between, a writer of the submitted buffer is waited out by the engine
+
+			while (true) {
+				int current = Volatile.Read(ref drawBuffers->current);
+				DrawBuffer* buffer = current == 0 ? &drawBuffers->first : &drawBuffers->second;
+
+				Interlocked.Increment(ref buffer->writers);
+
+				if (Volatile.Read(ref drawBuffers->current) == current)
+					return buffer;
+
+				Interlocked.Decrement(ref buffer->writers);
+			}
+		}
+
+		private static byte* Reserve(DrawBuffer* buffer, int size) {
+			long offset = Interlocked.Add(ref buffer->offset, size) - size;
+
+			if (offset + size <= buffer->capacity)
+				return buffer->data + offset;
+
+			// A record that crosses the end of the buffer terminates it, so that stale records of the previous frames are not submitted
+
+			if (offset + sizeof(DrawHeader) <= buffer->capacity)
+				((DrawHeader*)(buffer->data + offset))->size = 0;
+
+			Interlocked.Increment(ref buffer->overflows);
+
+			return null;
+		}
+
+		private static byte* WriteHeader(byte* data, DrawType type, int size) {
+			DrawHeader* header = (DrawHeader*)data;
+
+			header->type = type;
+			header->size = size;
+			header->context = Volatile.Read(ref drawBuffers->context);
+
+			return data + sizeof(DrawHeader);
+		}
+
+		private static void Write(DrawType type) {
+			if (drawBuffers->first.capacity == 0)
+				return;
+
+			DrawBuffer* buffer = Enter();
+			byte* data = Reserve(buffer, sizeof(DrawHeader));
+
+			if (data != null)
+				WriteHeader(data, type, sizeof(DrawHeader));
+
+			Interlocked.Decrement(ref buffer->writers);
+		}
+
+		private static void Write<T>(DrawType type, in T record) where T : unmanaged {
+			if (drawBuffers->first.capacity == 0)
+				return;
+
+			DrawBuffer* buffer = Enter();
+			int size = sizeof(DrawHeader) + sizeof(T);
+			byte* data = Reserve(buffer, size);
+
+			if (data != null)
+				*(T*)WriteHeader(data, type, size) = record;
+
+			Interlocked.Decrement(ref buffer->writers);
+		}
+
+		/// <summary>
+		/// Logs a message in accordance to the specified level, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void Log(LogLevel level, string message) {
+			if (message == null)
+				throw new ArgumentNullException(nameof(message));
+
+			log(level, message.StringToBytes());
+		}
+
+		/// <summary>
+		/// Creates a log file with the name of assembly if required and writes an exception to it, prints it on the screen, printing on the screen is omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration, but log file will persist
+		/// </summary>
+		public static void Exception(Exception exception) {
+			if (exception == null)
+				throw new ArgumentNullException(nameof(exception));
+
+			stringBuffer.Clear()
+			.AppendFormat("Time: {0}", DateTime.Now.ToString("dd/MM/yyyy hh:mm:ss tt"))
+			.AppendLine().AppendFormat("Message: {0}", exception.Message)
+			.AppendLine().AppendFormat("StackTrace: {0}", exception.StackTrace)
+			.AppendLine().AppendFormat("Source: {0}", exception.Source)
+			.AppendLine();
+
+			Debug.exception(stringBuffer.ToString().StringToBytes());
+
+			using (StreamWriter streamWriter = File.AppendText(Application.ProjectDirectory + "Saved/Logs/Exceptions-" + Assembly.GetCallingAssembly().GetName().Name + ".log")) {
+				streamWriter.WriteLine(stringBuffer);
+				streamWriter.Close();
+			}
+		}
+
+		/// <summary>
+		/// Prints a debug message on the screen assigned to the key identifier, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void AddOnScreenMessage(int key, float timeToDisplay, Color displayColor, string message) {
+			if (message == null)
+				throw new ArgumentNullException(nameof(message));
+
+			if (drawBuffers->first.capacity == 0)
+				return;
+
+			ReadOnlySpan<char> text = message.AsSpan(0, Math.Min(message.Length, maxMessageLength));
+			int length = Encoding.UTF8.GetByteCount(text);
+			int size = (sizeof(DrawHeader) + sizeof(Message) + length + 3) & ~3;
+			DrawBuffer* buffer = Enter();
+			byte* data = Reserve(buffer, size);
+
+			if (data != null) {
+				Message* record = (Message*)WriteHeader(data, DrawType.Message, size);
+
+				record->key = key;
+				record->timeToDisplay = timeToDisplay;
+				record->color = displayColor.ToArgb();
+				record->length = length;
+
+				Encoding.UTF8.GetBytes(text, new(record + 1, length));
+			}
+
+			Interlocked.Decrement(ref buffer->writers);
+		}
+
+		/// <summary>
+		/// Clears any existing debug messages, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void ClearOnScreenMessages() => Write(DrawType.ClearMessages);
+
+		/// <summary>
+		/// Draws a debug line, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawLine(in Vector3 start, in Vector3 end, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Line, new Line {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			start = start,
+			end = end
+		});
+
+		/// <summary>
+		/// Draws debug lines between each pair of points with a single reservation in the buffer, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawLines(ReadOnlySpan<Vector3> points, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) {
+			if (points.Length % 2 != 0)
+				throw new ArgumentException("Number of points should be even", nameof(points));
+
+			if (drawBuffers->first.capacity == 0 || points.Length == 0)
+				return;
+
+			DrawStyle style = new(color, persistentLines, lifeTime, depthPriority, thickness);
+			int size = sizeof(DrawHeader) + sizeof(Line);
+			DrawBuffer* buffer = Enter();
+			byte* data = Reserve(buffer, size * (points.Length / 2));
+
+			if (data != null) {
+				for (int i = 0; i < points.Length; i += 2, data += size) {
+					Line* line = (Line*)WriteHeader(data, DrawType.Line, size);
+
+					line->style = style;
+					line->start = points[i];
+					line->end = points[i + 1];
+				}
+			}
+
+			Interlocked.Decrement(ref buffer->writers);
+		}
+
+		/// <summary>
+		/// Draws a debug point, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawPoint(in Vector3 location, float size, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0) => Write(DrawType.Point, new Point {
+			style = new(color, persistentLines, lifeTime, depthPriority, 0.0f),
+			location = location,
+			size = size
+		});
+
+		/// <summary>
+		/// Draws a debug box, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawBox(in Vector3 center, in Vector3 extent, in Quaternion rotation, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Box, new Box {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			center = center,
+			extent = extent,
+			rotation = rotation
+		});
+
+		/// <summary>
+		/// Draws a debug capsule, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawCapsule(in Vector3 center, float halfHeight, float radius, in Quaternion rotation, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Capsule, new Capsule {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			center = center,
+			halfHeight = halfHeight,
+			radius = radius,
+			rotation = rotation
+		});
+
+		/// <summary>
+		/// Draws a debug cone, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawCone(in Vector3 origin, in Vector3 direction, float length, float angleWidth, float angleHeight, int sides, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Cone, new Cone {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			origin = origin,
+			direction = direction,
+			length = length,
+			angleWidth = angleWidth,
+			angleHeight = angleHeight,
+			sides = sides
+		});
+
+		/// <summary>
+		/// Draws a debug cylinder, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawCylinder(in Vector3 start, in Vector3 end, float radius, int segments, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Cylinder, new Cylinder {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			start = start,
+			end = end,
+			radius = radius,
+			segments = segments
+		});
+
+		/// <summary>
+		/// Draws a debug sphere, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void DrawSphere(in Vector3 center, float radius, int segments, Color color, bool persistentLines = false, float lifeTime = -1.0f, byte depthPriority = 0, float thickness = 0.0f) => Write(DrawType.Sphere, new Sphere {
+			style = new(color, persistentLines, lifeTime, depthPriority, thickness),
+			center = center,
+			radius = radius,
+			segments = segments
+		});
+
+		/// <summary>
+		/// Flushes persistent debug lines, records queued before are submitted first, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void FlushPersistentLines() => Write(DrawType.FlushPersistentLines);
+	}
+
+	/// <summary>
+	/// Provides information about the application
+	/// </summary>
+	public static unsafe partial class Application {
+		/// <summary>
+		/// Returns <c>true</c> if the application can render anything
+		/// </summary>
+		public static bool IsCanEverRender => Environment.IsCanEverRender;
+
+		/// <summary>
+		/// Returns <c>true</c> if current build is meant for release to retail
+		/// </summary>
+		public static bool IsPackagedForDistribution => Environment.IsPackagedForDistribution;
+
+		/// <summary>
+		/// Returns <c>true</c> if current build is packaged for shipping
+		/// </summary>
+		public static bool IsPackagedForShipping => Environment.IsPackagedForShipping;
+
+		/// <summary>
+		/// Returns the project directory
+		/// </summary>
+		public static string ProjectDirectory => Environment.ProjectDirectory;
+
+		/// <summary>
+		/// Returns the default language used by current platform
+		/// </summary>
+		public static string DefaultLanguage => Environment.DefaultLanguage;
+
+		/// <summary>
+		/// Gets or sets the name of the current project
+		/// </summary>
+		public static string ProjectName {
+			get => Environment.ProjectName;
+
+			set {
+				ArgumentNullException.ThrowIfNull(value);
+
+				setProjectName(value.StringToBytes());
+			}
+		}
+
+		/// <summary>
+		/// Returns the total number of framework calls made from the game thread, available in non-shipping builds
+		/// </summary>
+		public static long InteropCalls => getInteropCalls();
+
+		/// <summary>
+		/// Gets or sets the current volume multiplier
+		/// </summary>
+		public static float VolumeMultiplier {
+			get => getVolumeMultiplier();
+			set => setVolumeMultiplier(value);
+		}
+
+		/// <summary>
+		/// Requests application exit with the specified return code of the process
+		/// </summary>
+		public static void RequestExit(bool force = false, int returnCode = 0) => requestExit(force, returnCode);
+	}
+
+	/// <summary>
+	/// Represents the method that is invoked by the engine in a tick group
+	/// </summary>
+	public delegate void TickHandler(float deltaTime);
+
+	/// <summary>
+	/// Represents the method that is invoked by the engine in a tick group with the number of fixed substeps to simulate in the frame
+	/// </summary>
+	public delegate void FixedStepHandler(int substeps, float stepSize);
+
+	/// <summary>
+	/// The top-level representation of a map or a sandbox in which actors and components will exist and rendered
+	/// </summary>
+	public static unsafe partial class World {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct FixedStep {
+			internal IntPtr function;
+			internal float stepSize;
+			internal int maxSubsteps;
+			internal double accumulator;
+			internal int substeps;
+			internal float alpha;
+		}
+
+		private delegate void FixedStepDispatcher(IntPtr fixedStep);
+
+		internal static int* subscriberStates;
+		private static readonly Dictionary<int, TickHandler> subscribers = new();
+		private static readonly Dictionary<IntPtr, FixedStepDispatcher> fixedStepDispatchers = new();
+
+		/// <summary>
+		/// Enables the fixed-step mode for the tick group of the world that is currently executed, the engine accumulates frame time and invokes the handler once per frame with the number of substeps of the specified size, limited by the maximum number of substeps or the <c>clr.FixedStep.MaxSubsteps</c> console variable if zero
+		/// </summary>
+		public static void SetFixedStep(TickGroup tickGroup, FixedStepHandler handler, float stepSize, int maxSubsteps = 0) {
+			ArgumentNullException.ThrowIfNull(handler);
+
+			ArgumentOutOfRangeException.ThrowIfNegativeOrZero(stepSize);
+
+			ArgumentOutOfRangeException.ThrowIfNegative(maxSubsteps);
+
+			FixedStepDispatcher dispatcher = fixedStep => handler(((FixedStep*)fixedStep)->substeps, ((FixedStep*)fixedStep)->stepSize);
+			IntPtr function = Marshal.GetFunctionPointerForDelegate(dispatcher);
+			IntPtr previous;
+
+			if (!setFixedStep(tickGroup, function, stepSize, maxSubsteps, &previous))
+				throw new InvalidOperationException("Unable to set the fixed step for the " + tickGroup + " tick group");
+
+			fixedStepDispatchers.Remove(previous);
+			fixedStepDispatchers[function] = dispatcher;
+		}
+
+		/// <summary>
+		/// Disables the fixed-step mode for the tick group of the world that is currently executed
+		/// </summary>
+		public static void ClearFixedStep(TickGroup tickGroup) {
+			IntPtr previous;
+
+			if (setFixedStep(tickGroup, IntPtr.Zero, 0.0f, 0, &previous))
+				fixedStepDispatchers.Remove(previous);
+		}
+
+		/// <summary>
+		/// Returns the fraction of the fixed step accumulated after the last substep of the tick group, used to interpolate rendered state between the last two simulated states
+		/// </summary>
+		public static float GetInterpolationAlpha(TickGroup tickGroup) => getInterpolationAlpha(tickGroup);
+
+		/// <summary>
+		/// Returns the actor with the name in the world that is currently executed or an empty reference if not found, resolved through the hash index of the world unless the <c>clr.ActorIndex</c> console variable is zero
+		/// </summary>
+		public static ObjectReference FindActor(string name) {
+			ArgumentNullException.ThrowIfNull(name);
+
+			return ToReference(findActor(name.StringToBytes()));
+		}
+
+		/// <summary>
+		/// Returns the first actor with the tag in the world that is currently executed or an empty reference if not found, resolved through the hash index of the world unless the <c>clr.ActorIndex</c> console variable is zero
+		/// </summary>
+		public static ObjectReference FindActorByTag(string tag) {
+			ArgumentNullException.ThrowIfNull(tag);
+
+			return ToReference(findActorByTag(tag.StringToBytes()));
+		}
+
+		/// <summary>
+		/// Returns the actor with the unique ID in the world that is currently executed or an empty reference if not found, resolved through the hash index of the world unless the <c>clr.ActorIndex</c> console variable is zero
+		/// </summary>
+		public static ObjectReference FindActorByID(uint id) => ToReference(findActorByID(id));
+
+		private static ObjectReference ToReference(IntPtr actor) {
+			ObjectReference reference = default;
+
+			if (actor != IntPtr.Zero)
+				reference.Pointer = actor;
+
+			return reference;
+		}
+
+		/// <summary>
+		/// Subscribes the handler to the tick group of the world that is currently executed, subscribers with lower priority are invoked first
+		/// </summary>
+		public static Subscription Subscribe(TickGroup tickGroup, TickHandler handler, int priority = 0) {
+			ArgumentNullException.ThrowIfNull(handler);
+
+			int id = subscribe(tickGroup, Marshal.GetFunctionPointerForDelegate(handler), priority);
+
+			if (id < 0)
+				throw new InvalidOperationException("Unable to subscribe to the " + tickGroup + " tick group");
+
+			subscribers[id] = handler;
+
+			return new(id);
+		}
+
+		internal static void Unsubscribe(int id) {
+			unsubscribe(id);
+			subscribers.Remove(id);
+		}
+
+		/// <summary>
+		/// Executes traces and sweeps in parallel on the task graph workers and writes results to the span, returns the number of blocking hits
+		/// </summary>
+		public static int Trace(ReadOnlySpan<TraceQuery> queries, Span<Hit> results) {
+			if (results.Length < queries.Length)
+				throw new ArgumentOutOfRangeException(nameof(results));
+
+			fixed (TraceQuery* queriesPointer = queries) {
+				fixed (Hit* resultsPointer = results) {
+					return traceBatch(queriesPointer, resultsPointer, queries.Length);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// A subscription of a handler to a tick group
+	/// </summary>
+	public sealed unsafe class Subscription : IDisposable {
+		private int id;
+
+		internal Subscription(int id) => this.id = id;
+
+		/// <summary>
+		/// Returns <c>true</c> if the handler is still subscribed
+		/// </summary>
+		public bool IsSubscribed => id >= 0;
+
+		/// <summary>
+		/// Gets or sets whether the handler is invoked, changes are applied in shared memory without an interop call
+		/// </summary>
+		public bool Enabled {
+			get => id >= 0 && Volatile.Read(ref World.subscriberStates[id]) != 0;
+			set {
+				if (id >= 0)
+					Volatile.Write(ref World.subscriberStates[id], value ? 1 : 0);
+			}
+		}
+
+		/// <summary>
+		/// Unsubscribes the handler from the tick group
+		/// </summary>
+		public void Dispose() {
+			if (id < 0)
+				return;
+
+			World.Unsubscribe(id);
+
+			id = -1;
+		}
+	}
+
+	/// <summary>
+	/// A tick function of the world that is currently executed, registered in the engine as a separate function with its own interval and prerequisites
+	/// </summary>
+	public sealed unsafe partial class TickFunction : IDisposable {
+		private static readonly Dictionary<int, TickHandler> handlers = new();
+		private int handle;
+		private float interval;
+		private bool enabled;
+
+		/// <summary>
+		/// Registers the handler in the tick group, a non-zero interval in seconds throttles the execution, and the first execution is staggered with other throttled functions to avoid spikes
+		/// </summary>
+		public TickFunction(TickGroup tickGroup, TickHandler handler, float interval = 0.0f) {
+			ArgumentNullException.ThrowIfNull(handler);
+
+			ArgumentOutOfRangeException.ThrowIfNegative(interval);
+
+			handle = create(tickGroup, Marshal.GetFunctionPointerForDelegate(handler), interval);
+
+			if (handle < 0)
+				throw new InvalidOperationException("Unable to register a tick function in the " + tickGroup + " tick group");
+
+			handlers[handle] = handler;
+			this.interval = interval;
+			enabled = true;
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the tick function is registered
+		/// </summary>
+		public bool IsRegistered => handle >= 0;
+
+		/// <summary>
+		/// Gets or sets whether the tick function is executed
+		/// </summary>
+		public bool Enabled {
+			get => handle >= 0 && enabled;
+			set {
+				if (handle < 0)
+					return;
+
+				setEnabled(handle, value);
+				enabled = value;
+			}
+		}
+
+		/// <summary>
+		/// Gets or sets the interval in seconds between executions, zero executes the tick function every frame
+		/// </summary>
+		public float Interval {
+			get => interval;
+			set {
+				ArgumentOutOfRangeException.ThrowIfNegative(value);
+
+				if (handle < 0)
+					return;
+
+				setInterval(handle, value);
+				interval = value;
+			}
+		}
+
+		/// <summary>
+		/// Makes the tick function to execute after the primary tick of the actor or component
+		/// </summary>
+		public void AddPrerequisite(ObjectReference prerequisite) {
+			if (prerequisite.UncheckedPointer == IntPtr.Zero)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			if (handle >= 0)
+				addPrerequisite(handle, prerequisite.UncheckedPointer);
+		}
+
+		/// <summary>
+		/// Makes the tick function to execute after another tick function
+		/// </summary>
+		public void AddPrerequisite(TickFunction prerequisite) {
+			if (prerequisite == null || !prerequisite.IsRegistered)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			if (handle >= 0)
+				addTickFunctionPrerequisite(handle, prerequisite.handle);
+		}
+
+		/// <summary>
+		/// Unregisters the tick function from the engine
+		/// </summary>
+		public void Dispose() {
+			if (handle < 0)
+				return;
+
+			destroy(handle);
+			handlers.Remove(handle);
+
+			handle = -1;
+		}
+	}
+
+	/// <summary>
+	/// Represents the method that receives all input events of the bindings recorded since the last delivery and the number of events dropped when the buffer was full
+	/// </summary>
+	public delegate void InputEventsHandler(ReadOnlySpan<InputEvent> events, int dropped);
+
+	/// <summary>
+	/// Represents the method that receives callback identifiers of all timers expired in the frame
+	/// </summary>
+	public delegate void TimersHandler(ReadOnlySpan<int> callbackIds);
+
+	/// <summary>
+	/// A native hierarchical timer wheel of the world that is currently executed, expired timers are delivered once per frame before the pre-physics tick group
+	/// </summary>
+	public static unsafe partial class TimerWheel {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct TimerBatch {
+			internal int* ids;
+			internal int count;
+		}
+
+		private delegate void DispatchHandler(IntPtr batch);
+
+		private static readonly DispatchHandler dispatcher = Dispatch;
+
+		/// <summary>
+		/// Gets or sets the handler invoked with callback identifiers of all timers expired in the frame, in the order of expiration
+		/// </summary>
+		public static TimersHandler Expired { get; set; }
+
+		/// <summary>
+		/// Returns the number of scheduled timers
+		/// </summary>
+		public static int Count => getCount();
+
+		internal static void Initialize() => setHandler(Marshal.GetFunctionPointerForDelegate(dispatcher));
+
+		/// <summary>
+		/// Schedules a timer that expires after the delay in seconds of game time with the callback identifier, a non-zero period in seconds makes the timer repeating, returns a handle of the timer
+		/// </summary>
+		public static int Schedule(float delay, int callbackId, float period = 0.0f) {
+			ArgumentOutOfRangeException.ThrowIfNegative(delay);
+
+			ArgumentOutOfRangeException.ThrowIfNegative(period);
+
+			int handle = schedule(delay, period, callbackId);
+
+			if (handle < 0)
+				throw new InvalidOperationException("Unable to schedule a timer");
+
+			return handle;
+		}
+
+		/// <summary>
+		/// Cancels the timer, returns <c>false</c> if the timer is already expired or cancelled
+		/// </summary>
+		public static bool Cancel(int handle) => cancel(handle);
+
+		/// <summary>
+		/// Returns <c>true</c> if the timer is scheduled
+		/// </summary>
+		public static bool IsScheduled(int handle) => isScheduled(handle);
+
+		/// <summary>
+		/// Returns the remaining time in seconds until the timer expires
+		/// </summary>
+		public static float GetRemaining(int handle) => getRemaining(handle);
+
+		private static void Dispatch(IntPtr batch) {
+			TimerBatch* timerBatch = (TimerBatch*)batch;
+
+			Expired?.Invoke(new(timerBatch->ids, timerBatch->count));
+		}
+	}
+
+	/// <summary>
+	/// A function of the engine's object resolved once by name, invoked with parameters written directly to a preallocated native frame without string formatting and parsing
+	/// </summary>
+	public sealed unsafe partial class FunctionHandle : IDisposable {
+		private int handle;
+		private byte* parameters;
+		private readonly int parametersSize;
+
+		/// <summary>
+		/// Resolves the function by name in the class of the object, all parameters of the function should be blittable
+		/// </summary>
+		public FunctionHandle(ObjectReference target, string name) {
+			if (target.UncheckedPointer == IntPtr.Zero)
+				throw new ArgumentNullException(nameof(target));
+
+			ArgumentNullException.ThrowIfNull(name);
+
+			int size = 0;
+
+			handle = resolve(target.UncheckedPointer, name.StringToBytes(), &size);
+
+			if (handle < 0)
+				throw new InvalidOperationException("Unable to resolve the " + name + " function with blittable parameters");
+
+			parameters = getParameters(handle);
+			parametersSize = size;
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the function is resolved
+		/// </summary>
+		public bool IsResolved => handle >= 0;
+
+		/// <summary>
+		/// Returns the size of the parameters frame in bytes
+		/// </summary>
+		public int ParametersSize => parametersSize;
+
+		/// <summary>
+		/// Returns the memory of the parameters frame, including out parameters and the return value after invocation
+		/// </summary>
+		public Span<byte> Parameters => handle >= 0 ? new(parameters, parametersSize) : Span<byte>.Empty;
+
+		/// <summary>
+		/// Returns the offset of the parameter or the return value in the frame, resolve it once and reuse
+		/// </summary>
+		public int GetParameterOffset(string name) {
+			ArgumentNullException.ThrowIfNull(name);
+
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			int offset = getParameterOffset(handle, name.StringToBytes());
+
+			if (offset < 0)
+				throw new ArgumentException("Parameter " + name + " is not found", nameof(name));
+
+			return offset;
+		}
+
+		/// <summary>
+		/// Writes the value of the parameter to the frame at the offset
+		/// </summary>
+		public void SetParameter<T>(int offset, T value) where T : unmanaged {
+			CheckBounds(offset, sizeof(T));
+
+			Unsafe.WriteUnaligned(parameters + offset, value);
+		}
+
+		/// <summary>
+		/// Writes the boolean parameter to the frame at the offset
+		/// </summary>
+		public void SetParameter(int offset, bool value) => SetParameter(offset, value ? (byte)1 : (byte)0);
+
+		/// <summary>
+		/// Writes the object parameter to the frame at the offset
+		/// </summary>
+		public void SetParameter(int offset, ObjectReference value) => SetParameter(offset, value.UncheckedPointer);
+
+		/// <summary>
+		/// Reads the value of the parameter or the return value from the frame at the offset
+		/// </summary>
+		public T GetParameter<T>(int offset) where T : unmanaged {
+			CheckBounds(offset, sizeof(T));
+
+			return Unsafe.ReadUnaligned<T>(parameters + offset);
+		}
+
+		/// <summary>
+		/// Invokes the function on the object with the current parameters frame, returns <c>false</c> if the object is invalid or doesn't have the function
+		/// </summary>
+		public bool Invoke(ObjectReference target) {
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			return invoke(handle, target.UncheckedPointer);
+		}
+
+		/// <summary>
+		/// Releases the parameters frame
+		/// </summary>
+		public void Dispose() {
+			if (handle < 0)
+				return;
+
+			release(handle);
+
+			handle = -1;
+			parameters = null;
+		}
+
+		private void CheckBounds(int offset, int size) {
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			if (offset < 0 || offset + size > parametersSize)
+				throw new ArgumentOutOfRangeException(nameof(offset));
+		}
+	}
+
+	/// <summary>
+	/// A query of actors in the world filtered natively by class, tags, component, and bounds, matching actors are returned as a contiguous span in one call
+	/// </summary>
+	public sealed unsafe partial class ActorQuery : IDisposable {
+		[StructLayout(LayoutKind.Explicit, Size = 56)]
+		internal struct Description {
+			[FieldOffset(0)]
+			internal byte* actorClass;
+			[FieldOffset(8)]
+			internal byte* componentClass;
+			[FieldOffset(16)]
+			internal byte** tags;
+			[FieldOffset(24)]
+			internal int tagsCount;
+			[FieldOffset(28)]
+			internal Bool incremental;
+			[FieldOffset(29)]
+			internal Bool useBounds;
+			[FieldOffset(32)]
+			internal Vector3 boundsMin;
+			[FieldOffset(44)]
+			internal Vector3 boundsMax;
+		}
+
+		private int handle;
+		private readonly bool incremental;
+
+		/// <summary>
+		/// Creates the query of actors with the class such as <c>StaticMeshActor</c> or a path to a blueprint class, that have all the tags and a component of the class, any of the filters is optional
+		/// </summary>
+		/// <param name="actorClass">The class of actors, or <c>null</c> for any actor</param>
+		/// <param name="componentClass">The class of a component that actors should have, or <c>null</c> for any</param>
+		/// <param name="tags">Tags that actors should have, or <c>null</c> for any</param>
+		/// <param name="incremental">If <c>true</c>, the world is scanned once and the snapshot is updated only from spawned and destroyed actors, tags and components of an actor are evaluated once after it's spawned</param>
+		public ActorQuery(string actorClass = null, string componentClass = null, string[] tags = null, bool incremental = false) : this(actorClass, componentClass, tags, incremental, false, default, default) { }
+
+		/// <summary>
+		/// Creates the query of actors located inside the bounds, the world is scanned on every update
+		/// </summary>
+		public ActorQuery(Vector3 boundsMin, Vector3 boundsMax, string actorClass = null, string componentClass = null, string[] tags = null) : this(actorClass, componentClass, tags, false, true, boundsMin, boundsMax) { }
+
+		private ActorQuery(string actorClass, string componentClass, string[] tags, bool incremental, bool useBounds, Vector3 boundsMin, Vector3 boundsMax) {
+			int tagsCount = tags?.Length ?? 0;
+			byte** tagsPointers = stackalloc byte*[tagsCount];
+
+			for (int i = 0; i < tagsCount; i++) {
+				if (tags[i] == null)
+					throw new ArgumentNullException(nameof(tags));
+
+				tagsPointers[i] = tags[i].StringToBytes();
+			}
+
+			Description description = new() {
+				actorClass = actorClass.StringToBytes(),
+				componentClass = componentClass.StringToBytes(),
+				tags = tagsPointers,
+				tagsCount = tagsCount,
+				incremental = incremental,
+				useBounds = useBounds,
+				boundsMin = boundsMin,
+				boundsMax = boundsMax
+			};
+
+			handle = create(&description);
+
+			if (handle < 0)
+				throw new InvalidOperationException("Unable to create the query of actors, see the output log");
+
+			this.incremental = incremental;
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the query is updated from spawned and destroyed actors instead of scanning the world
+		/// </summary>
+		public bool IsIncremental => incremental;
+
+		/// <summary>
+		/// Scans the world or applies spawned and destroyed actors to the incremental snapshot and returns matching actors, the span is valid until the next update or disposal, the order of actors in the incremental snapshot is not preserved
+		/// </summary>
+		public ReadOnlySpan<ObjectReference> Update() {
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			int count = 0;
+			ObjectReference* actors = update(handle, &count);
+
+			return new(actors, count);
+		}
+
+		/// <summary>
+		/// Releases the query
+		/// </summary>
+		public void Dispose() {
+			if (handle < 0)
+				return;
+
+			release(handle);
+
+			handle = -1;
+		}
+	}
+
+	/// <summary>
+	/// Input events of action and axis bindings of local players in the world that is currently executed, recorded to a native buffer and delivered once per frame in the chosen tick group instead of a callback per event
+	/// </summary>
+	public static unsafe partial class InputEvents {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct InputBatch {
+			internal InputEvent* events;
+			internal int count;
+			internal int dropped;
+		}
+
+		private delegate void DispatchHandler(IntPtr batch);
+
+		private static readonly DispatchHandler dispatcher = Dispatch;
+
+		/// <summary>
+		/// Gets or sets the handler invoked once per frame with input events in the order they are recorded
+		/// </summary>
+		public static InputEventsHandler Received { get; set; }
+
+		internal static void Initialize() => setHandler(Marshal.GetFunctionPointerForDelegate(dispatcher));
+
+		/// <summary>
+		/// Sets the tick group in which input events are delivered, the pre-physics tick group by default, events recorded after the delivery in the frame are delivered in the next frame
+		/// </summary>
+		public static void SetTickGroup(TickGroup tickGroup) {
+			if (!setTickGroup(tickGroup))
+				throw new InvalidOperationException("Unable to deliver input events in the " + tickGroup + " tick group");
+		}
+
+		/// <summary>
+		/// Binds the action mapping of the input settings, pressed and released events are recorded, returns an identifier of the binding that is stored in events
+		/// </summary>
+		public static int BindAction(string actionName) {
+			ArgumentNullException.ThrowIfNull(actionName);
+
+			int binding = bindAction(actionName.StringToBytes());
+
+			if (binding < 0)
+				throw new InvalidOperationException("Unable to bind the action");
+
+			return binding;
+		}
+
+		/// <summary>
+		/// Binds the axis mapping of the input settings, non-zero values and the return to zero are recorded, returns an identifier of the binding that is stored in events
+		/// </summary>
+		public static int BindAxis(string axisName) {
+			ArgumentNullException.ThrowIfNull(axisName);
+
+			int binding = bindAxis(axisName.StringToBytes());
+
+			if (binding < 0)
+				throw new InvalidOperationException("Unable to bind the axis");
+
+			return binding;
+		}
+
+		/// <summary>
+		/// Removes the binding, returns <c>false</c> if the binding is not found
+		/// </summary>
+		public static bool Unbind(int binding) => unbind(binding);
+
+		private static void Dispatch(IntPtr batch) {
+			InputBatch* inputBatch = (InputBatch*)batch;
+
+			Received?.Invoke(new(inputBatch->events, inputBatch->count), inputBatch->dropped);
+		}
+	}
+
+	/// <summary>
+	/// Functionality to access pixels of 2D textures without copying them through the interop, mips are locked as spans of native memory and uploads read pixels directly from pinned managed memory
+	/// </summary>
+	public static unsafe partial class TexturePixels {
+		[StructLayout(LayoutKind.Sequential)]
+		private struct UploadBatch {
+			internal int* ids;
+			internal int count;
+		}
+
+		private struct Upload {
+			internal MemoryHandle pixels;
+			internal Action released;
+		}
+
+		private delegate void DispatchHandler(IntPtr batch);
+
+		private static readonly DispatchHandler dispatcher = Dispatch;
+		private static readonly Dictionary<int, Upload> uploads = new();
+		private static int uploadsId;
+
+		/// <summary>
+		/// Returns the number of uploads that are not yet copied by the rendering thread
+		/// </summary>
+		public static int PendingUploads => uploads.Count;
+
+		internal static void Initialize() => setHandler(Marshal.GetFunctionPointerForDelegate(dispatcher));
+
+		/// <summary>
+		/// Locks the mip of the texture for reading and writing and returns its pixels, the span is valid until the mip is unlocked, only mips that are resident in memory such as of transient textures can be locked
+		/// </summary>
+		public static Span<byte> LockMip(ObjectReference texture, int mip, out int width, out int height) {
+			int w, h, size;
+			byte* pixels = lockMip(texture.Pointer, mip, &w, &h, &size);
+
+			if (pixels == null)
+				throw new InvalidOperationException("Unable to lock the mip " + mip + " of the texture");
+
+			width = w;
+			height = h;
+
+			return new(pixels, size);
+		}
+
+		/// <summary>
+		/// Unlocks the mip of the texture and updates the resource of the texture to upload the changed pixels
+		/// </summary>
+		public static void UnlockMip(ObjectReference texture, int mip, bool updateResource = true) {
+			if (!unlockMip(texture.Pointer, mip, updateResource))
+				throw new InvalidOperationException("The mip " + mip + " of the texture is not locked");
+		}
+
+		/// <summary>
+		/// Submits regions of the pixels to the rendering thread that copies them to the mip of the texture, the memory stays pinned until the copy completes and the optional callback is invoked on the game thread at the end of the frame when the memory can be reused
+		/// </summary>
+		public static void UpdateRegions(ObjectReference texture, int mip, ReadOnlySpan<TextureRegion> regions, ReadOnlyMemory<byte> pixels, int pitch, int bytesPerPixel, Action released = null) {
+			if (regions.Length == 0)
+				throw new ArgumentOutOfRangeException(nameof(regions));
+
+			ArgumentOutOfRangeException.ThrowIfNegativeOrZero(pitch);
+
+			ArgumentOutOfRangeException.ThrowIfNegativeOrZero(bytesPerPixel);
+
+			foreach (TextureRegion region in regions) {
+				if (region.SourceX < 0 || region.SourceY < 0 || region.Width <= 0 || region.Height <= 0 || (long)(region.SourceY + region.Height - 1) * pitch + (long)(region.SourceX + region.Width) * bytesPerPixel > pixels.Length)
+					throw new ArgumentOutOfRangeException(nameof(regions));
+			}
+
+			int id = uploadsId++;
+			MemoryHandle handle = pixels.Pin();
+
+			fixed (TextureRegion* regionsPointer = regions) {
+				if (!updateRegions(texture.Pointer, mip, regionsPointer, regions.Length, pitch, bytesPerPixel, (byte*)handle.Pointer, id)) {
+					handle.Dispose();
+
+					throw new InvalidOperationException("Unable to update regions of the mip " + mip + " of the texture");
+				}
+			}
+
+			uploads[id] = new() {
+				pixels = handle,
+				released = released
+			};
+		}
+
+		private static void Dispatch(IntPtr batch) {
+			UploadBatch* uploadBatch = (UploadBatch*)batch;
+
+			for (int i = 0; i < uploadBatch->count; i++) {
+				if (uploads.Remove(uploadBatch->ids[i], out Upload upload)) {
+					upload.pixels.Dispose();
+					upload.released?.Invoke();
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Functionality to sample and edit spline components in bulk, each call evaluates or modifies all points in a single native loop
+	/// </summary>
+	public static unsafe partial class Spline {
+		/// <summary>
+		/// Samples the spline component at each key and writes the results to the spans that are not empty, the spans must be at least as long as the keys
+		/// </summary>
+		public static void Sample(ObjectReference splineComponent, ReadOnlySpan<float> keys, SplineSampleMode mode, SplineCoordinateSpace coordinateSpace, Span<Vector3> locations = default, Span<Vector3> tangents = default, Span<Quaternion> rotations = default, Span<Transform> transforms = default) {
+			CheckLength(locations.Length, keys.Length, nameof(locations));
+			CheckLength(tangents.Length, keys.Length, nameof(tangents));
+			CheckLength(rotations.Length, keys.Length, nameof(rotations));
+			CheckLength(transforms.Length, keys.Length, nameof(transforms));
+
+			fixed (float* keysPointer = keys) {
+				fixed (Vector3* locationsPointer = locations) {
+					fixed (Vector3* tangentsPointer = tangents) {
+						fixed (Quaternion* rotationsPointer = rotations) {
+							fixed (Transform* transformsPointer = transforms) {
+								if (!sample(splineComponent.Pointer, keysPointer, keys.Length, mode, coordinateSpace, locationsPointer, tangentsPointer, rotationsPointer, transformsPointer))
+									throw new InvalidOperationException("The object is not a spline component");
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Replaces all points of the spline component with the locations and optional tangents, the spline is updated once
+		/// </summary>
+		public static void SetPoints(ObjectReference splineComponent, ReadOnlySpan<Vector3> locations, SplineCoordinateSpace coordinateSpace, ReadOnlySpan<Vector3> tangents = default) {
+			CheckLength(tangents.Length, locations.Length, nameof(tangents));
+
+			fixed (Vector3* locationsPointer = locations) {
+				fixed (Vector3* tangentsPointer = tangents) {
+					if (!setPoints(splineComponent.Pointer, locationsPointer, tangentsPointer, locations.Length, coordinateSpace))
+						throw new InvalidOperationException("The object is not a spline component");
+				}
+			}
+		}
+
+		/// <summary>
+		/// Modifies the locations and optional tangents of the points at the indices of the spline component, the spline is updated once
+		/// </summary>
+		public static void UpdatePoints(ObjectReference splineComponent, ReadOnlySpan<int> indices, ReadOnlySpan<Vector3> locations, SplineCoordinateSpace coordinateSpace, ReadOnlySpan<Vector3> tangents = default) {
+			if (locations.Length < indices.Length)
+				throw new ArgumentOutOfRangeException(nameof(locations));
+
+			CheckLength(tangents.Length, indices.Length, nameof(tangents));
+
+			fixed (int* indicesPointer = indices) {
+				fixed (Vector3* locationsPointer = locations) {
+					fixed (Vector3* tangentsPointer = tangents) {
+						if (!updatePoints(splineComponent.Pointer, indicesPointer, locationsPointer, tangentsPointer, indices.Length, coordinateSpace))
+							throw new InvalidOperationException("The object is not a spline component or an index is out of range");
+					}
+				}
+			}
+		}
+
+		private static void CheckLength(int length, int count, string name) {
+			if (length != 0 && length < count)
+				throw new ArgumentOutOfRangeException(name);
+		}
+	}
+
+	/// <summary>
+	/// A set of animation curves and parameters resolved once by name and accessed for many animation instances or skeletal mesh components in one call, values are stored as a structure of arrays where the value of each name for all instances is contiguous
+	/// </summary>
+	public sealed unsafe partial class AnimationBinding : IDisposable {
+		private int handle;
+		private readonly int curvesCount;
+		private readonly int parametersCount;
+
+		/// <summary>
+		/// Creates the binding of curves that are read and numeric or boolean properties of animation instances that are read and written
+		/// </summary>
+		public AnimationBinding(string[] curves, string[] parameters = null) {
+			ArgumentNullException.ThrowIfNull(curves);
+
+			parameters ??= Array.Empty<string>();
+			curvesCount = curves.Length;
+			parametersCount = parameters.Length;
+
+			byte** curvesPointers = stackalloc byte*[curvesCount];
+			byte** parametersPointers = stackalloc byte*[parametersCount];
+
+			for (int i = 0; i < curvesCount; i++) {
+				if (curves[i] == null)
+					throw new ArgumentNullException(nameof(curves));
+
+				curvesPointers[i] = curves[i].StringToBytes();
+			}
+
+			for (int i = 0; i < parametersCount; i++) {
+				if (parameters[i] == null)
+					throw new ArgumentNullException(nameof(parameters));
+
+				parametersPointers[i] = parameters[i].StringToBytes();
+			}
+
+			handle = create(curvesPointers, curvesCount, parametersPointers, parametersCount);
+		}
+
+		/// <summary>
+		/// Returns the number of bound curves
+		/// </summary>
+		public int CurvesCount => curvesCount;
+
+		/// <summary>
+		/// Returns the number of bound parameters
+		/// </summary>
+		public int ParametersCount => parametersCount;
+
+		/// <summary>
+		/// Reads curves and parameters of the instances to the spans, the value of the curve or the parameter at index <c>i</c> for the instance at index <c>j</c> is stored at <c>i * instances.Length + j</c>, values of instances that are not valid are zero, returns the number of instances that are read
+		/// </summary>
+		/// <remarks>Can be called from the <see cref="TickGroup.DuringPhysics"/> tick group while animations are evaluated in parallel, an instance that is still being evaluated is read after its evaluation completes, which blocks the calling thread</remarks>
+		public int Read(ReadOnlySpan<ObjectReference> instances, Span<float> curves, Span<float> parameters = default) {
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			if (curves.Length < curvesCount * instances.Length)
+				throw new ArgumentOutOfRangeException(nameof(curves));
+
+			if (parameters.Length < parametersCount * instances.Length)
+				throw new ArgumentOutOfRangeException(nameof(parameters));
+
+			fixed (ObjectReference* instancesPointer = instances) {
+				fixed (float* curvesPointer = curves) {
+					fixed (float* parametersPointer = parameters) {
+						return read(handle, instancesPointer, instances.Length, curvesPointer, parametersPointer);
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Writes parameters of the instances from the span laid out as in <see cref="Read"/>, boolean properties are set when the value is not zero, returns the number of instances that are written
+		/// </summary>
+		public int Write(ReadOnlySpan<ObjectReference> instances, ReadOnlySpan<float> parameters) {
+			ObjectDisposedException.ThrowIf(handle < 0, this);
+
+			if (parameters.Length < parametersCount * instances.Length)
+				throw new ArgumentOutOfRangeException(nameof(parameters));
+
+			fixed (ObjectReference* instancesPointer = instances) {
+				fixed (float* parametersPointer = parameters) {
+					return write(handle, instancesPointer, instances.Length, parametersPointer);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Releases the binding
+		/// </summary>
+		public void Dispose() {
+			if (handle < 0)
+				return;
+
+			release(handle);
+
+			handle = -1;
+		}
+	}
+
+	/// <summary>
+	/// A batch of traces and sweeps with results stored in pinned memory, executed immediately or asynchronously with results available in the next frame
+	/// </summary>
+	public sealed unsafe class TraceBatch {
+		private const int pendingResult = -1;
+		private readonly TraceQuery[] queries;
+		private readonly Hit[] results;
+		private int count;
+		private int handle = -1;
+		private int blockingHits;
+
+		/// <summary>
+		/// Creates the batch with the specified capacity
+		/// </summary>
+		public TraceBatch(int capacity) {
+			ArgumentOutOfRangeException.ThrowIfNegativeOrZero(capacity);
+
+			queries = GC.AllocateUninitializedArray<TraceQuery>(capacity, pinned: true);
+			results = GC.AllocateUninitializedArray<Hit>(capacity, pinned: true);
+		}
+
+		/// <summary>
+		/// Returns the maximum number of queries in the batch
+		/// </summary>
+		public int Capacity => queries.Length;
+
+		/// <summary>
+		/// Returns the number of queries in the batch
+		/// </summary>
+		public int Count => count;
+
+		/// <summary>
+		/// Returns <c>true</c> if the batch is submitted and results are not yet available
+		/// </summary>
+		public bool IsPending => handle != -1;
+
+		/// <summary>
+		/// Returns the number of blocking hits of the last completed execution
+		/// </summary>
+		public int BlockingHits => blockingHits;
+
+		/// <summary>
+		/// Returns results of the last completed execution in the order of added queries
+		/// </summary>
+		public ReadOnlySpan<Hit> Results {
+			get {
+				ThrowIfPending();
+
+				return new(results, 0, count);
+			}
+		}
+
+		/// <summary>
+		/// Adds the query to the batch
+		/// </summary>
+		public void Add(in TraceQuery query) {
+			ThrowIfPending();
+
+			if (count == queries.Length)
+				throw new InvalidOperationException("The batch is full");
+
+			queries[count++] = query;
+		}
+
+		/// <summary>
+		/// Removes all queries from the batch
+		/// </summary>
+		public void Clear() {
+			ThrowIfPending();
+
+			count = 0;
+			blockingHits = 0;
+		}
+
+		/// <summary>
+		/// Executes the batch in parallel on the task graph workers and blocks until completion, returns the number of blocking hits
+		/// </summary>
+		public int Execute() {
+			ThrowIfPending();
+
+			fixed (TraceQuery* queriesPointer = queries) {
+				fixed (Hit* resultsPointer = results) {
+					blockingHits = World.traceBatch(queriesPointer, resultsPointer, count);
+				}
+			}
+
+			return blockingHits;
+		}
+
+		/// <summary>
+		/// Submits the batch to the asynchronous trace path of the engine, use <see cref="TryComplete"/> in the next frame to retrieve results, results that are not retrieved within two frames are dropped
+		/// </summary>
+		public void Submit() {
+			ThrowIfPending();
+
+			fixed (TraceQuery* queriesPointer = queries) {
+				fixed (Hit* resultsPointer = results) {
+					handle = World.submitTraceBatch(queriesPointer, resultsPointer, count);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the submitted batch is completed and results are available
+		/// </summary>
+		/// <exception cref="InvalidOperationException">Thrown if the batch expired before its results were retrieved or its world ended, the batch is no longer pending</exception>
+		public bool TryComplete() {
+			if (!IsPending)
+				return true;
+
+			int result = World.queryTraceBatch(handle);
+
+			if (result == pendingResult)
+				return false;
+
+			if (result < 0) {
+				handle = -1;
+				blockingHits = 0;
+
+				throw new InvalidOperationException("The batch is expired");
+			}
+
+			blockingHits = result;
+			handle = -1;
+
+			return true;
+		}
+
+		private void ThrowIfPending() {
+			if (IsPending)
+				throw new InvalidOperationException("The batch is pending");
+		}
+	}
+
+	/// <summary>
+	/// A representation of the collision shape
+	/// </summary>
+	[StructLayout(LayoutKind.Explicit, Size = 16)]
+	public struct CollisionShape : IEquatable<CollisionShape> {
+		[FieldOffset(0)]
+		private CollisionShapeType shapeType;
+		[FieldOffset(4)]
+		private Vector3 box;
+		[FieldOffset(4)]
+		private float sphere;
+		[FieldOffset(4)]
+		private float capsuleRadius;
+		[FieldOffset(8)]
+		private float capsuleHalfHeight;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(CollisionShape left, CollisionShape right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(CollisionShape left, CollisionShape right) => !left.Equals(right);
+
+		/// <summary>
+		/// Returns the shape type
+		/// </summary>
+		public CollisionShapeType ShapeType => shapeType;
+
+		/// <summary>
+		/// Returns a box shape
+		/// </summary>
+		public static CollisionShape CreateBox(Vector3 halfExtent) => new() {
+			shapeType = CollisionShapeType.Box,
+			box = halfExtent
+		};
+
+		/// <summary>
+		/// Returns a sphere shape
+		/// </summary>
+		public static CollisionShape CreateSphere(float radius) => new() {
+			shapeType = CollisionShapeType.Sphere,
+			sphere = radius
+		};
+
+		/// <summary>
+		/// Returns a capsule shape
+		/// </summary>
+		public static CollisionShape CreateCapsule(float radius, float halfHeight) => new() {
+			shapeType = CollisionShapeType.Capsule,
+			capsuleRadius = radius,
+			capsuleHalfHeight = halfHeight
+		};
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(CollisionShape other) => shapeType == other.shapeType && box == other.box;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is CollisionShape other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(shapeType, box);
+	}
+
+	/// <summary>
+	/// An input event of an action or axis binding
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public readonly struct InputEvent : IEquatable<InputEvent> {
+		private readonly int binding;
+		private readonly InputEventType type;
+		private readonly float value;
+		private readonly int player;
+		private readonly double timestamp;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(InputEvent left, InputEvent right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(InputEvent left, InputEvent right) => !left.Equals(right);
+
+		/// <summary>
+		/// Returns the identifier of the binding
+		/// </summary>
+		public int Binding => binding;
+
+		/// <summary>
+		/// Returns the type of the event
+		/// </summary>
+		public InputEventType Type => type;
+
+		/// <summary>
+		/// Returns the value of the axis, one for pressed actions, or zero for released actions
+		/// </summary>
+		public float Value => value;
+
+		/// <summary>
+		/// Returns the controller ID of the local player
+		/// </summary>
+		public int Player => player;
+
+		/// <summary>
+		/// Returns the time in seconds of the platform clock when the event is recorded
+		/// </summary>
+		public double Timestamp => timestamp;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(InputEvent other) => binding == other.binding && type == other.type && value == other.value && player == other.player && timestamp == other.timestamp;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is InputEvent other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(binding, type, value, player, timestamp);
+	}
+
+	/// <summary>
+	/// A rectangular region of pixels copied from the source to the destination in a texture
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct TextureRegion : IEquatable<TextureRegion> {
+		private int destinationX;
+		private int destinationY;
+		private int sourceX;
+		private int sourceY;
+		private int width;
+		private int height;
+
+		/// <summary>
+		/// Initializes a new instance of the region
+		/// </summary>
+		public TextureRegion(int destinationX, int destinationY, int sourceX, int sourceY, int width, int height) {
+			this.destinationX = destinationX;
+			this.destinationY = destinationY;
+			this.sourceX = sourceX;
+			this.sourceY = sourceY;
+			this.width = width;
+			this.height = height;
+		}
+
+		/// <summary>
+		/// Returns the horizontal position in the texture
+		/// </summary>
+		public int DestinationX => destinationX;
+
+		/// <summary>
+		/// Returns the vertical position in the texture
+		/// </summary>
+		public int DestinationY => destinationY;
+
+		/// <summary>
+		/// Returns the horizontal position in the source pixels
+		/// </summary>
+		public int SourceX => sourceX;
+
+		/// <summary>
+		/// Returns the vertical position in the source pixels
+		/// </summary>
+		public int SourceY => sourceY;
+
+		/// <summary>
+		/// Returns the width in pixels
+		/// </summary>
+		public int Width => width;
+
+		/// <summary>
+		/// Returns the height in pixels
+		/// </summary>
+		public int Height => height;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(TextureRegion left, TextureRegion right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(TextureRegion left, TextureRegion right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(TextureRegion other) => destinationX == other.destinationX && destinationY == other.destinationY && sourceX == other.sourceX && sourceY == other.sourceY && width == other.width && height == other.height;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is TextureRegion other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(destinationX, destinationY, sourceX, sourceY, width, height);
+	}
+
+	/// <summary>
+	/// A transformation of location, rotation, and scale
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Transform : IEquatable<Transform> {
+		private Vector3 location;
+		private Quaternion rotation;
+		private Vector3 scale;
+
+		/// <summary>
+		/// Returns the identity transformation
+		/// </summary>
+		public static Transform Identity => new(Vector3.Zero, Quaternion.Identity, Vector3.One);
+
+		/// <summary>
+		/// Initializes a new instance of the transformation
+		/// </summary>
+		public Transform(Vector3 location, Quaternion rotation, Vector3 scale) {
+			this.location = location;
+			this.rotation = rotation;
+			this.scale = scale;
+		}
+
+		/// <summary>
+		/// Gets or sets the location
+		/// </summary>
+		public Vector3 Location {
+			get => location;
+			set => location = value;
+		}
+
+		/// <summary>
+		/// Gets or sets the rotation
+		/// </summary>
+		public Quaternion Rotation {
+			get => rotation;
+			set => rotation = value;
+		}
+
+		/// <summary>
+		/// Gets or sets the scale
+		/// </summary>
+		public Vector3 Scale {
+			get => scale;
+			set => scale = value;
+		}
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(Transform left, Transform right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(Transform left, Transform right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(Transform other) => location == other.location && rotation == other.rotation && scale == other.scale;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is Transform other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(location, rotation, scale);
+	}
+
+	/// <summary>
+	/// A descriptor of a trace or a sweep for batched spatial queries
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct TraceQuery : IEquatable<TraceQuery> {
+		private Vector3 start;
+		private Vector3 end;
+		private Quaternion rotation;
+		private CollisionShape shape;
+		private CollisionChannel channel;
+		private Bool traceComplex;
+		private IntPtr ignoredActor;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(TraceQuery left, TraceQuery right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(TraceQuery left, TraceQuery right) => !left.Equals(right);
+
+		/// <summary>
+		/// Returns the start location of the query
+		/// </summary>
+		public Vector3 Start => start;
+
+		/// <summary>
+		/// Returns the end location of the query
+		/// </summary>
+		public Vector3 End => end;
+
+		/// <summary>
+		/// Returns the collision channel of the query
+		/// </summary>
+		public CollisionChannel Channel => channel;
+
+		/// <summary>
+		/// Returns the shape of the query, <see cref="CollisionShapeType.Line"/> for line traces
+		/// </summary>
+		public CollisionShape Shape => shape;
+
+		/// <summary>
+		/// Returns a line trace query
+		/// </summary>
+		public static TraceQuery CreateLine(Vector3 start, Vector3 end, CollisionChannel channel, bool traceComplex = false, ObjectReference ignoredActor = default) => new() {
+			start = start,
+			end = end,
+			rotation = Quaternion.Identity,
+			channel = channel,
+			traceComplex = traceComplex,
+			ignoredActor = ignoredActor.UncheckedPointer
+		};
+
+		/// <summary>
+		/// Returns a sweep query of the shape
+		/// </summary>
+		public static TraceQuery CreateSweep(Vector3 start, Vector3 end, Quaternion rotation, CollisionShape shape, CollisionChannel channel, bool traceComplex = false, ObjectReference ignoredActor = default) => new() {
+			start = start,
+			end = end,
+			rotation = rotation,
+			shape = shape,
+			channel = channel,
+			traceComplex = traceComplex,
+			ignoredActor = ignoredActor.UncheckedPointer
+		};
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(TraceQuery other) => start == other.start && end == other.end && rotation == other.rotation && shape == other.shape && channel == other.channel && traceComplex == other.traceComplex && ignoredActor == other.ignoredActor;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is TraceQuery other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(start, end, rotation, shape, channel, ignoredActor);
+	}
+
+	/// <summary>
+	/// A trace hit
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct Hit : IEquatable<Hit> {
+		private Vector3 location;
+		private Vector3 impactLocation;
+		private Vector3 normal;
+		private Vector3 impactNormal;
+		private Vector3 traceStart;
+		private Vector3 traceEnd;
+		private IntPtr actor;
+		private float time;
+		private float distance;
+		private float penetrationDepth;
+		private Bool blockingHit;
+		private Bool startPenetrating;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(Hit left, Hit right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(Hit left, Hit right) => !left.Equals(right);
+
+		/// <summary>
+		/// Returns the location in world space where the moving shape would end up against the impacted object if there was a hit
+		/// </summary>
+		public Vector3 Location => location;
+
+		/// <summary>
+		/// Returns the location in world space of the actual contact of the trace shape with the impacted object
+		/// </summary>
+		public Vector3 ImpactLocation => impactLocation;
+
+		/// <summary>
+		/// Returns the normal of the hit in world space for the object that was swept
+		/// </summary>
+		public Vector3 Normal => normal;
+
+		/// <summary>
+		/// Returns the normal of the hit in world space for the object that was hit by the sweep
+		/// </summary>
+		public Vector3 ImpactNormal => impactNormal;
+
+		/// <summary>
+		/// Returns the start location of the trace
+		/// </summary>
+		public Vector3 TraceStart => traceStart;
+
+		/// <summary>
+		/// Returns the end location of the trace
+		/// </summary>
+		public Vector3 TraceEnd => traceEnd;
+
+		/// <summary>
+		/// Returns the impact along trace direction between 0.0f and 1.0f if there was a hit, indicating time between <see cref="TraceStart"/> and <see cref="TraceEnd"/>
+		/// </summary>
+		public float Time => time;
+
+		/// <summary>
+		/// Returns the distance from <see cref="TraceStart"/> to <see cref="Location"/> in world space
+		/// </summary>
+		public float Distance => distance;
+
+		/// <summary>
+		/// Returns the distance along with <see cref="Normal"/> that will result in moving out of penetration if <see cref="StartPenetrating"/> is <c>true</c> and a penetration vector can be computed
+		/// </summary>
+		public float PenetrationDepth => penetrationDepth;
+
+		/// <summary>
+		/// Returns <c>true</c> if the hit was a result of blocking collision
+		/// </summary>
+		public bool BlockingHit => blockingHit;
+
+		/// <summary>
+		/// Returns <c>true</c> if the trace started penetration
+		/// </summary>
+		public bool StartPenetrating => startPenetrating;
+
+		/// <summary>
+		/// Returns the owner actor of the component that was hit or an empty reference on failure
+		/// </summary>
+		public ObjectReference GetActor() {
+			ObjectReference reference = default;
+
+			if (actor != IntPtr.Zero)
+				reference.Pointer = actor;
+
+			return reference;
+		}
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(Hit other) => location == other.location && impactLocation == other.impactLocation && normal == other.normal && impactNormal == other.impactNormal && traceStart == other.traceStart && traceEnd == other.traceEnd && actor == other.actor && time == other.time && distance == other.distance;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) => value is Hit other && Equals(other);
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(location, impactLocation, normal, impactNormal, actor, time);
+	}
+
+    /// <summary>
+    /// A representation of the engine's object reference
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public unsafe struct ObjectReference : IEquatable<ObjectReference>
+    {
+        private IntPtr pointer;
+
+        internal IntPtr Pointer
+        {
+            get
+            {
+                if (!IsCreated)
+                    throw new InvalidOperationException();
+
+                return pointer;
+            }
+
+            set
+            {
+                if (value == IntPtr.Zero)
+                    throw new InvalidOperationException();
+
+                pointer = value;
+            }
+        }
+
+        internal IntPtr UncheckedPointer => pointer;
+
+        /// <summary>
+        /// Tests for equality between two objects
+        /// </summary>
+        public static bool operator ==(ObjectReference left, ObjectReference right) => left.Equals(right);
+
+        /// <summary>
+        /// Tests for inequality between two objects
+        /// </summary>
+        public static bool operator !=(ObjectReference left, ObjectReference right) => !left.Equals(right);
+
+        /// <summary>
+        /// Returns <c>true</c> if the object is created
+        /// </summary>
+        public bool IsCreated => pointer != IntPtr.Zero && Object.isValid(pointer);
+
+        /// <summary>
+        /// Returns the unique ID of the object, reused by the engine, only unique while the object is alive
+        /// </summary>
+        public uint ID => Object.getID(Pointer);
+
+        /// <summary>
+        /// Returns the name of the object
+        /// </summary>
+        public string Name
+        {
+            get
+            {
+                return Extensions.BytesToString(Object.getName(Pointer));
             }
         }
 
@@ -0,0 +1,779 @@
+/*
+ *  Unreal Engine .NET 6 integration 
+ *  Copyright (c) 2021 Stanislav Denisov
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Text;
+using System.Threading;
+
+namespace UnrealEngine.Replay {
+	internal enum RecordType : byte {
+		CommandBegin = 1,
+		CommandEnd = 2,
+		CallBegin = 3,
+		CallEnd = 4
+	}
+
+	internal enum CallbackType : int {
+		ActorOverlapDelegate,
+		ActorHitDelegate,
+		ActorCursorDelegate,
+		ActorKeyDelegate,
+		ComponentOverlapDelegate,
+		ComponentHitDelegate,
+		ComponentCursorDelegate,
+		ComponentKeyDelegate,
+		CharacterLandedDelegate
+	}
+
+	internal enum ArgumentType : int {
+		None,
+		Single,
+		Integer,
+		Pointer,
+		Callback
+	}
+
+	internal enum CommandType : int {
+		Initialize = 1,
+		LoadAssemblies = 2,
+		UnloadAssemblies = 3,
+		Find = 4,
+		Execute = 5,
+		Idle = 6,
+		Trace = 7,
+		Frame = 8
+	}
+
+	[StructLayout(LayoutKind.Explicit, Size = 16)]
+	internal unsafe struct Callback {
+		[FieldOffset(0)]
+		internal IntPtr* parameters;
+		[FieldOffset(8)]
+		internal CallbackType type;
+	}
+
+	[StructLayout(LayoutKind.Explicit, Size = 24)]
+	internal unsafe struct Argument {
+		[FieldOffset(0)]
+		internal float single;
+		[FieldOffset(0)]
+		internal uint integer;
+		[FieldOffset(0)]
+		internal IntPtr pointer;
+		[FieldOffset(0)]
+		internal Callback callback;
+		[FieldOffset(16)]
+		internal ArgumentType type;
+	}
+
+	[StructLayout(LayoutKind.Explicit, Size = 40)]
+	internal unsafe struct Command {
+		// Initialize
+		[FieldOffset(0)]
+		internal IntPtr* buffer;
+		[FieldOffset(8)]
+		internal int checksum;
+		// Find
+		[FieldOffset(0)]
+		internal IntPtr method;
+		[FieldOffset(8)]
+		internal int optional;
+		// Execute, Idle
+		[FieldOffset(0)]
+		internal IntPtr function;
+		[FieldOffset(8)]
+		internal Argument value;
+		[FieldOffset(32)]
+		internal CommandType type;
+	}
+
+	internal sealed class Binding {
+		internal short table;
+		internal short index;
+		internal string name;
+		internal string signature;
+		internal Delegate stub;
+
+		internal char Result => signature[0];
+
+		internal string Arguments => signature[2..^1];
+	}
+
+	internal sealed class Statistics {
+		internal readonly List<double> replayTimes = new();
+		internal double recordedTime;
+		internal double replayTime;
+
+		internal void Add(double recorded, double replay) {
+			recordedTime += recorded;
+			replayTime += replay;
+			replayTimes.Add(replay);
+		}
+
+		internal double GetPercentile(double percentile) {
+			replayTimes.Sort();
+
+			return replayTimes[(int)Math.Clamp(Math.Ceiling(percentile * replayTimes.Count) - 1, 0, replayTimes.Count - 1)];
+		}
+	}
+
+	internal sealed class CaptureReader {
+		private readonly byte[] data;
+		internal int position;
+
+		internal CaptureReader(byte[] data) => this.data = data;
+
+		internal bool End => position >= data.Length;
+
+		internal RecordType Peek() => (RecordType)data[position];
+
+		internal ushort PeekFunction() => BinaryPrimitives.ReadUInt16LittleEndian(data.AsSpan(position + 1));
+
+		internal byte ReadByte() => data[position++];
+
+		internal short ReadInt16() => BinaryPrimitives.ReadInt16LittleEndian(data.AsSpan(Advance(sizeof(short))));
+
+		internal ushort ReadUInt16() => BinaryPrimitives.ReadUInt16LittleEndian(data.AsSpan(Advance(sizeof(ushort))));
+
+		internal int ReadInt32() => BinaryPrimitives.ReadInt32LittleEndian(data.AsSpan(Advance(sizeof(int))));
+
+		internal uint ReadUInt32() => BinaryPrimitives.ReadUInt32LittleEndian(data.AsSpan(Advance(sizeof(uint))));
+
+		internal ulong ReadUInt64() => BinaryPrimitives.ReadUInt64LittleEndian(data.AsSpan(Advance(sizeof(ulong))));
+
+		internal string ReadString() {
+			int length = ReadUInt16();
+
+			return Encoding.UTF8.GetString(data, Advance(length), length);
+		}
+
+		internal ulong ReadValue(char kind) => kind switch {
+			'v' => 0,
+			'b' => ReadByte(),
+			'i' or 'f' => ReadUInt32(),
+			'l' or 'p' => ReadUInt64(),
+			_ => throw new InvalidDataException("Unknown type of the value " + kind)
+		};
+
+		private int Advance(int size) {
+			int start = position;
+
+			position += size;
+
+			return start;
+		}
+	}
+
+	internal static unsafe class Replay {
+		private const string captureMagic = "UCLRCAP";
+		private const uint captureVersion = 1;
+		private const int blockSize = 64 * 1024;
+		private const int arenaSize = 2 * 1024 * 1024;
+		private const int mutationQueueCapacity = 64;
+		private static readonly string[] eventNames = { "OnWorldBegin", "OnWorldPostBegin", "OnWorldPrePhysicsTick", "OnWorldDuringPhysicsTick", "OnWorldPostPhysicsTick", "OnWorldPostUpdateTick", "OnWorldEnd", "OnActorBeginOverlap", "OnActorEndOverlap", "OnActorHit", "OnActorBeginCursorOver", "OnActorEndCursorOver", "OnActorClicked", "OnActorReleased", "OnComponentBeginOverlap", "OnComponentEndOverlap", "OnComponentHit", "OnComponentBeginCursorOver", "OnComponentEndCursorOver", "OnComponentClicked", "OnComponentReleased" };
+		private static readonly ModuleBuilder moduleBuilder = AssemblyBuilder.DefineDynamicAssembly(new("UnrealEngine.ReplayStubs"), AssemblyBuilderAccess.Run).DefineDynamicModule("UnrealEngine.ReplayStubs");
+		private static readonly Dictionary<string, Type> delegateTypes = new(StringComparer.Ordinal);
+		private static readonly Dictionary<ulong, IntPtr> pointers = new();
+		private static readonly Dictionary<IntPtr, string> labels = new();
+		private static readonly Dictionary<ulong, IntPtr> blocks = new();
+		private static readonly List<IntPtr> allocations = new();
+		private static readonly Dictionary<string, Statistics> statistics = new(StringComparer.Ordinal);
+		private static delegate* unmanaged[Cdecl]<Command, IntPtr> managedCommand;
+		private static CaptureReader reader;
+		private static Binding[] bindings;
+		private static string projectDirectory;
+		private static IntPtr environment;
+		private static IntPtr arena;
+		private static IntPtr mutationQueue;
+		private static IntPtr scratch;
+		private static int gameThreadId;
+		private static int divergences;
+		private static int unresolved;
+		private static bool replaying;
+		private static bool unloaded;
+
+		private static int Main(string[] arguments) {
+			if (arguments.Length < 2) {
+				Console.Error.WriteLine("Usage: UnrealEngine.Replay <Capture> <Project> [--iterations Count] [--csv Path] [--warmup]");
+
+				return 1;
+			}
+
+			string capturePath = arguments[0];
+			string csvPath = null;
+			int iterations = 1;
+			bool warmup = false;
+
+			projectDirectory = Path.TrimEndingDirectorySeparator(Path.GetFullPath(arguments[1]));
+
+			for (int i = 2; i < arguments.Length; i++) {
+				if (arguments[i] == "--iterations" && i + 1 < arguments.Length)
+					iterations = Math.Max(int.Parse(arguments[++i], CultureInfo.InvariantCulture), 1);
+				else if (arguments[i] == "--csv" && i + 1 < arguments.Length)
+					csvPath = arguments[++i];
+				else if (arguments[i] == "--warmup")
+					warmup = true;
+			}
+
+			// Hot methods recorded by the replay would not reflect the game, so the warmup is opt-in
+
+			AppContext.SetData("UnrealCLR.Warmup.Enabled", warmup ? "true" : "false");
+
+			string runtimePath = Path.Combine(projectDirectory, "Plugins", "UnrealCLR", "Managed", "UnrealEngine.Runtime.dll");
+			AssemblyDependencyResolver resolver = new(runtimePath);
+
+			AssemblyLoadContext.Default.Resolving += (context, name) => resolver.ResolveAssemblyToPath(name) is string path ? context.LoadFromAssemblyPath(path) : null;
+
+			Assembly runtime = AssemblyLoadContext.Default.LoadFromAssemblyPath(runtimePath);
+
+			managedCommand = (delegate* unmanaged[Cdecl]<Command, IntPtr>)runtime.GetType("UnrealEngine.Runtime.Core").GetMethod("ManagedCommand", BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
+			reader = new(File.ReadAllBytes(capturePath));
+			gameThreadId = Environment.CurrentManagedThreadId;
+
+			int checksum = ReadHeader();
+			int streamPosition = reader.position;
+
+			Initialize(checksum);
+
+			for (int iteration = 0; iteration < iterations; iteration++) {
+				Begin();
+
+				reader.position = streamPosition;
+				replaying = true;
+
+				long start = Stopwatch.GetTimestamp();
+
+				Run(0);
+
+				double elapsed = Stopwatch.GetElapsedTime(start).TotalMilliseconds;
+
+				replaying = false;
+
+				if (!unloaded)
+					managedCommand(new() { type = CommandType.UnloadAssemblies });
+
+				End();
+
+				Console.WriteLine("Iteration " + (iteration + 1) + ": " + elapsed.ToString("F2", CultureInfo.InvariantCulture) + " ms, " + divergences + " divergent calls, " + unresolved + " unresolved commands");
+			}
+
+			// Statistics of the last iteration are reported, earlier iterations warm up the runtime
+
+			Report(csvPath);
+
+			return divergences == 0 ? 0 : 2;
+		}
+
+		private static int ReadHeader() {
+			if (reader.End || Encoding.ASCII.GetString(Enumerable.Range(0, captureMagic.Length).Select(_ => reader.ReadByte()).ToArray()) != captureMagic || reader.ReadByte() != 0)
+				throw new InvalidDataException("File is not a capture");
+
+			uint version = reader.ReadUInt32();
+
+			if (version != captureVersion)
+				throw new InvalidDataException("Capture version " + version + " is not supported");
+
+			int checksum = reader.ReadInt32();
+
+			bindings = new Binding[reader.ReadUInt16()];
+
+			for (int i = 0; i < bindings.Length; i++) {
+				bindings[i] = new() {
+					table = reader.ReadInt16(),
+					index = reader.ReadInt16(),
+					name = reader.ReadString(),
+					signature = reader.ReadString()
+				};
+			}
+
+			return checksum;
+		}
+
+		private static void Initialize(int checksum) {
+			IntPtr* runtimeFunctions = (IntPtr*)Allocate(3 * sizeof(IntPtr));
+			IntPtr* functions = (IntPtr*)Allocate(128 * sizeof(IntPtr));
+
+			for (int i = 0; i < bindings.Length; i++) {
+				Binding binding = bindings[i];
+
+				if (binding.index < 0)
+					continue;
+
+				binding.stub = CreateStub(i, binding);
+
+				IntPtr stub = Marshal.GetFunctionPointerForDelegate(binding.stub);
+
+				if (binding.table < 0) {
+					runtimeFunctions[binding.index] = stub;
+				} else {
+					if (functions[binding.table] == IntPtr.Zero)
+						functions[binding.table] = Allocate(128 * sizeof(IntPtr));
+
+					((IntPtr*)functions[binding.table])[binding.index] = stub;
+				}
+			}
+
+			IntPtr* buffer = stackalloc IntPtr[3];
+
+			buffer[0] = (IntPtr)runtimeFunctions;
+			buffer[1] = (IntPtr)functions;
+			buffer[2] = Allocate(512);
+
+			Command command = default;
+
+			command.buffer = buffer;
+			command.checksum = checksum;
+			command.type = CommandType.Initialize;
+
+			if (managedCommand(command) != (IntPtr)0xF)
+				throw new InvalidOperationException("Runtime initialization failed");
+
+			allocations.Clear();
+		}
+
+		private static void Begin() {
+			pointers.Clear();
+			labels.Clear();
+			blocks.Clear();
+			statistics.Clear();
+
+			divergences = 0;
+			unresolved = 0;
+			unloaded = false;
+			scratch = Allocate(blockSize);
+
+			// Engine memory shared with the framework is backed by blocks with the same layout
+
+			byte* environmentBlock = (byte*)Allocate(56);
+
+			*(int*)environmentBlock = 1;
+			*(IntPtr*)(environmentBlock + 8) = AllocateString(projectDirectory + "/");
+			*(IntPtr*)(environmentBlock + 16) = AllocateString("en");
+			*(IntPtr*)(environmentBlock + 24) = AllocateString(Path.GetFileName(projectDirectory));
+			*(IntPtr*)(environmentBlock + 32) = AllocateString(string.Empty);
+
+			environment = (IntPtr)environmentBlock;
+
+			byte* arenaBlock = (byte*)Allocate(40);
+
+			*(IntPtr*)arenaBlock = Allocate(arenaSize);
+			*(long*)(arenaBlock + 8) = arenaSize;
+
+			arena = (IntPtr)arenaBlock;
+
+			byte* mutationQueueBlock = (byte*)Allocate(192);
+			byte* entries = (byte*)Allocate(mutationQueueCapacity * 64);
+
+			for (int i = 0; i < mutationQueueCapacity; i++) {
+				*(long*)(entries + i * 64) = i;
+			}
+
+			*(IntPtr*)mutationQueueBlock = (IntPtr)entries;
+			*(long*)(mutationQueueBlock + 8) = mutationQueueCapacity;
+
+			mutationQueue = (IntPtr)mutationQueueBlock;
+		}
+
+		private static void End() {
+			foreach (IntPtr allocation in allocations) {
+				NativeMemory.Free((void*)allocation);
+			}
+
+			allocations.Clear();
+		}
+
+		private static void Run(RecordType terminator) {
+			while (!reader.End) {
+				RecordType type = (RecordType)reader.ReadByte();
+
+				if (type == terminator)
+					return;
+
+				if (type == RecordType.CommandBegin) {
+					Execute();
+				} else if (type == RecordType.CallBegin) {
+					divergences++;
+					SkipCall();
+				} else {
+					throw new InvalidDataException("Unexpected record " + type + " at " + (reader.position - 1));
+				}
+			}
+		}
+
+		private static void Execute() {
+			reader.ReadUInt64();
+
+			Command command = default;
+			IntPtr* parameters = stackalloc IntPtr[4];
+			string method = null;
+			string label;
+			bool resolved = true;
+
+			command.type = (CommandType)reader.ReadInt32();
+
+			if (command.type == CommandType.Find) {
+				method = reader.ReadString();
+				label = "Find " + method;
+
+				command.optional = reader.ReadInt32();
+			} else {
+				ulong function = reader.ReadUInt64();
+
+				command.value.type = (ArgumentType)reader.ReadInt32();
+
+				ulong value = reader.ReadUInt64();
+
+				switch (command.value.type) {
+					case ArgumentType.Single:
+						command.value.single = BitConverter.Int32BitsToSingle((int)value);
+						break;
+
+					case ArgumentType.Integer:
+						command.value.integer = (uint)value;
+						break;
+
+					// Payloads of the engine are not captured, pointers are replaced with zeroed memory
+
+					case ArgumentType.Pointer:
+						new Span<byte>((void*)scratch, blockSize).Clear();
+						command.value.pointer = scratch;
+						break;
+
+					case ArgumentType.Callback:
+						command.value.callback.type = (CallbackType)reader.ReadInt32();
+						command.value.callback.parameters = parameters;
+
+						for (int i = reader.ReadByte() - 1; i >= 0; i--) {
+							parameters[i] = (IntPtr)reader.ReadUInt64();
+						}
+
+						break;
+				}
+
+				label = command.type.ToString();
+
+				if (command.type == CommandType.Execute) {
+					resolved = pointers.TryGetValue(function, out command.function);
+					label = resolved ? labels.GetValueOrDefault(command.function, "Function") : "Unresolved";
+				}
+			}
+
+			if (!resolved) {
+				unresolved++;
+				Skip(RecordType.CommandEnd);
+				reader.ReadUInt64();
+				reader.ReadUInt64();
+
+				return;
+			}
+
+			if (method != null)
+				command.method = Marshal.StringToHGlobalAnsi(method);
+
+			long start = Stopwatch.GetTimestamp();
+			IntPtr result = managedCommand(command);
+			double replayTime = Stopwatch.GetElapsedTime(start).TotalMilliseconds;
+
+			if (method != null)
+				Marshal.FreeHGlobal(command.method);
+
+			Run(RecordType.CommandEnd);
+
+			double recordedTime = reader.ReadUInt64() / 1e6;
+			ulong recordedResult = reader.ReadUInt64();
+
+			if (command.type == CommandType.Find)
+				Map(recordedResult, result, method);
+			else if (command.type == CommandType.Idle)
+				ResetArena();
+			else if (command.type == CommandType.UnloadAssemblies)
+				unloaded = true;
+
+			if (!statistics.TryGetValue(label, out Statistics entry))
+				statistics.Add(label, entry = new());
+
+			entry.Add(recordedTime, replayTime);
+		}
+
+		private static long Call(int id, long* arguments) {
+			Binding binding = bindings[id];
+			string kinds = binding.Arguments;
+
+			if (binding.name.EndsWith("::Exception", StringComparison.Ordinal))
+				Console.Error.WriteLine(Marshal.PtrToStringUTF8((nint)arguments[0]));
+			else if (binding.name.EndsWith("::Log", StringComparison.Ordinal) && (int)arguments[0] >= 2)
+				Console.Error.WriteLine(Marshal.PtrToStringUTF8((nint)arguments[1]));
+
+			// Calls from other threads are not captured
+
+			if (!replaying || Environment.CurrentManagedThreadId != gameThreadId)
+				return 0;
+
+			if (reader.End || reader.Peek() != RecordType.CallBegin || reader.PeekFunction() != id) {
+				divergences++;
+
+				return 0;
+			}
+
+			reader.ReadByte();
+			reader.ReadUInt16();
+
+			for (int i = 0; i < kinds.Length; i++) {
+				ulong value = reader.ReadValue(kinds[i]);
+
+				if (kinds[i] == 'p')
+					Map(value, (nint)arguments[i], binding.name.EndsWith("::RegisterEvent", StringComparison.Ordinal) && (uint)arguments[0] < (uint)eventNames.Length ? eventNames[arguments[0]] : binding.name[(binding.name.IndexOf("::", StringComparison.Ordinal) + 2)..]);
+			}
+
+			// Commands executed by the engine during the call are replayed before returning the recorded result
+
+			Run(RecordType.CallEnd);
+
+			reader.ReadUInt64();
+
+			ulong result = reader.ReadValue(binding.Result);
+
+			return binding.Result == 'p' ? (long)GetBlock(binding, result) : (long)result;
+		}
+
+		private static void Skip(RecordType terminator) {
+			while (true) {
+				RecordType type = (RecordType)reader.ReadByte();
+
+				if (type == terminator)
+					return;
+
+				if (type == RecordType.CommandBegin) {
+					reader.ReadUInt64();
+
+					if ((CommandType)reader.ReadInt32() == CommandType.Find) {
+						reader.ReadString();
+						reader.ReadInt32();
+					} else {
+						reader.ReadUInt64();
+
+						ArgumentType argumentType = (ArgumentType)reader.ReadInt32();
+
+						reader.ReadUInt64();
+
+						if (argumentType == ArgumentType.Callback) {
+							reader.ReadInt32();
+							reader.position += reader.ReadByte() * sizeof(ulong);
+						}
+					}
+
+					Skip(RecordType.CommandEnd);
+					reader.ReadUInt64();
+					reader.ReadUInt64();
+				} else if (type == RecordType.CallBegin) {
+					SkipCall();
+				} else {
+					throw new InvalidDataException("Unexpected record " + type + " at " + (reader.position - 1));
+				}
+			}
+		}
+
+		private static void SkipCall() {
+			Binding binding = bindings[reader.ReadUInt16()];
+
+			foreach (char kind in binding.Arguments) {
+				reader.ReadValue(kind);
+			}
+
+			Skip(RecordType.CallEnd);
+			reader.ReadUInt64();
+			reader.ReadValue(binding.Result);
+		}
+
+		private static void Map(ulong recorded, IntPtr pointer, string label) {
+			if (recorded == 0 || pointer == IntPtr.Zero)
+				return;
+
+			pointers[recorded] = pointer;
+			labels.TryAdd(pointer, label);
+		}
+
+		private static IntPtr GetBlock(Binding binding, ulong recorded) {
+			if (recorded == 0)
+				return IntPtr.Zero;
+
+			if (!blocks.TryGetValue(recorded, out IntPtr block)) {
+				if (binding.name.EndsWith("::GetEnvironment", StringComparison.Ordinal))
+					block = environment;
+				else if (binding.name.EndsWith("::GetFrameArena", StringComparison.Ordinal))
+					block = arena;
+				else if (binding.name.EndsWith("::GetMutationQueue", StringComparison.Ordinal))
+					block = mutationQueue;
+				else
+					block = Allocate(blockSize);
+
+				blocks.Add(recorded, block);
+			}
+
+			return block;
+		}
+
+		private static void ResetArena() {
+			byte* arenaBlock = (byte*)arena;
+
+			*(long*)(arenaBlock + 16) = 0;
+			*(int*)(arenaBlock + 32) += 1;
+			*(int*)(arenaBlock + 36) = 0;
+		}
+
+		private static IntPtr Allocate(int size) {
+			IntPtr block = (IntPtr)NativeMemory.AllocZeroed((nuint)size);
+
+			allocations.Add(block);
+
+			return block;
+		}
+
+		private static IntPtr AllocateString(string value) {
+			byte[] bytes = Encoding.UTF8.GetBytes(value + '\0');
+			IntPtr block = Allocate(bytes.Length);
+
+			Marshal.Copy(bytes, 0, block, bytes.Length);
+
+			return block;
+		}
+
+		private static Type GetValueType(char kind) => kind switch {
+			'v' => typeof(void),
+			'b' => typeof(byte),
+			'i' => typeof(int),
+			'f' => typeof(float),
+			'l' => typeof(long),
+			'p' => typeof(IntPtr),
+			_ => throw new InvalidDataException("Unknown type of the value " + kind)
+		};
+
+		private static Type GetDelegateType(string signature, Type returnType, Type[] parameters) {
+			if (delegateTypes.TryGetValue(signature, out Type type))
+				return type;
+
+			TypeBuilder builder = moduleBuilder.DefineType("Stub" + delegateTypes.Count, TypeAttributes.Class | TypeAttributes.Public | TypeAttributes.Sealed | TypeAttributes.AnsiClass | TypeAttributes.AutoClass, typeof(MulticastDelegate));
+
+			builder.SetCustomAttribute(new(typeof(UnmanagedFunctionPointerAttribute).GetConstructor(new[] { typeof(CallingConvention) }), new object[] { CallingConvention.Cdecl }));
+			builder.DefineConstructor(MethodAttributes.RTSpecialName | MethodAttributes.HideBySig | MethodAttributes.Public, CallingConventions.Standard, new[] { typeof(object), typeof(IntPtr) }).SetImplementationFlags(MethodImplAttributes.Runtime | MethodImplAttributes.Managed);
+			builder.DefineMethod("Invoke", MethodAttributes.Public | MethodAttributes.HideBySig | MethodAttributes.NewSlot | MethodAttributes.Virtual, returnType, parameters).SetImplementationFlags(MethodImplAttributes.Runtime | MethodImplAttributes.Managed);
+
+			type = builder.CreateType();
+			delegateTypes.Add(signature, type);
+
+			return type;
+		}
+
+		private static Delegate CreateStub(int id, Binding binding) {
+			string kinds = binding.Arguments;
+			Type returnType = GetValueType(binding.Result);
+			Type[] parameters = kinds.Select(GetValueType).ToArray();
+			DynamicMethod method = new("Stub" + id, returnType, parameters, typeof(Replay).Module, true);
+			ILGenerator generator = method.GetILGenerator();
+			LocalBuilder arguments = generator.DeclareLocal(typeof(long*));
+
+			// Arguments are widened to 64-bit slots and passed to the interpreter with the function identifier
+
+			generator.Emit(OpCodes.Ldc_I4, Math.Max(kinds.Length, 1) * sizeof(long));
+			generator.Emit(OpCodes.Conv_U);
+			generator.Emit(OpCodes.Localloc);
+			generator.Emit(OpCodes.Stloc, arguments);
+
+			for (int i = 0; i < kinds.Length; i++) {
+				generator.Emit(OpCodes.Ldloc, arguments);
+				generator.Emit(OpCodes.Ldc_I4, i * sizeof(long));
+				generator.Emit(OpCodes.Add);
+				generator.Emit(OpCodes.Ldarg, (short)i);
+
+				if (kinds[i] == 'f')
+					generator.Emit(OpCodes.Call, typeof(BitConverter).GetMethod(nameof(BitConverter.SingleToInt32Bits)));
+
+				generator.Emit(kinds[i] == 'b' ? OpCodes.Conv_U8 : OpCodes.Conv_I8);
+				generator.Emit(OpCodes.Stind_I8);
+			}
+
+			generator.Emit(OpCodes.Ldc_I4, id);
+			generator.Emit(OpCodes.Ldloc, arguments);
+			generator.Emit(OpCodes.Call, typeof(Replay).GetMethod(nameof(Call), BindingFlags.NonPublic | BindingFlags.Static));
+
+			switch (binding.Result) {
+				case 'v':
+					generator.Emit(OpCodes.Pop);
+					break;
+
+				case 'b':
+					generator.Emit(OpCodes.Conv_U1);
+					break;
+
+				case 'i':
+					generator.Emit(OpCodes.Conv_I4);
+					break;
+
+				case 'f':
+					generator.Emit(OpCodes.Conv_I4);
+					generator.Emit(OpCodes.Call, typeof(BitConverter).GetMethod(nameof(BitConverter.Int32BitsToSingle)));
+					break;
+
+				case 'p':
+					generator.Emit(OpCodes.Conv_I);
+					break;
+			}
+
+			generator.Emit(OpCodes.Ret);
+
+			return method.CreateDelegate(GetDelegateType(binding.signature, returnType, parameters));
+		}
+
+		private static void Report(string csvPath) {
+			KeyValuePair<string, Statistics>[] entries = statistics.OrderByDescending(entry => entry.Value.replayTime).ToArray();
+
+			Console.WriteLine();
+			Console.WriteLine("{0,-48} {1,10} {2,14} {3,14} {4,12} {5,12}", "Function", "Count", "Recorded (ms)", "Replay (ms)", "P50 (us)", "P99 (us)");
+
+			foreach (KeyValuePair<string, Statistics> entry in entries) {
+				Console.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0,-48} {1,10} {2,14:F3} {3,14:F3} {4,12:F1} {5,12:F1}", entry.Key, entry.Value.replayTimes.Count, entry.Value.recordedTime, entry.Value.replayTime, entry.Value.GetPercentile(0.5) * 1000.0, entry.Value.GetPercentile(0.99) * 1000.0));
+			}
+
+			if (csvPath == null)
+				return;
+
+			using StreamWriter writer = new(csvPath);
+
+			writer.WriteLine("Function,Count,RecordedMs,ReplayMs,P50Us,P99Us");
+
+			foreach (KeyValuePair<string, Statistics> entry in entries) {
+				writer.WriteLine(string.Format(CultureInfo.InvariantCulture, "\"{0}\",{1},{2:F3},{3:F3},{4:F1},{5:F1}", entry.Key, entry.Value.replayTimes.Count, entry.Value.recordedTime, entry.Value.replayTime, entry.Value.GetPercentile(0.5) * 1000.0, entry.Value.GetPercentile(0.99) * 1000.0));
+			}
+		}
+	}
+}
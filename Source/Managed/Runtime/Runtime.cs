@@ -23,13 +23,23 @@
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
+using System.Diagnostics.Tracing;
+using System.Globalization;
 using System.IO;
+using System.Linq;
 using System.Reflection;
 using System.Reflection.Emit;
+using System.Reflection.Metadata;
+using System.Reflection.PortableExecutable;
+using System.Runtime;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Runtime.Loader;
 using System.Runtime.Serialization;
+using System.Threading;
+using System.Threading.Tasks;
+using Microsoft.Diagnostics.NETCore.Client;
 using UnrealEngine.Plugins;
 
 namespace UnrealEngine.Runtime {
@@ -65,7 +75,10 @@ namespace UnrealEngine.Runtime {
 		LoadAssemblies = 2,
 		UnloadAssemblies = 3,
 		Find = 4,
-		Execute = 5
+		Execute = 5,
+		Idle = 6,
+		Trace = 7,
+		Frame = 8
 	}
 
 	[StructLayout(LayoutKind.Explicit, Size = 16)]
@@ -102,7 +115,7 @@ namespace UnrealEngine.Runtime {
 		internal IntPtr method;
 		[FieldOffset(8)]
 		internal int optional;
-		// Execute
+		// Execute, Idle
 		[FieldOffset(0)]
 		internal IntPtr function;
 		[FieldOffset(8)]
@@ -111,7 +124,136 @@ namespace UnrealEngine.Runtime {
 		internal CommandType type;
 	}
 
+	[StructLayout(LayoutKind.Explicit, Size = 56)]
+	internal unsafe struct Telemetry {
+		[FieldOffset(0)]
+		internal long executeAllocatedBytes;
+		[FieldOffset(8)]
+		internal long frameAllocatedBytes;
+		[FieldOffset(16)]
+		internal long heapSize;
+		[FieldOffset(24)]
+		internal long committedSize;
+		[FieldOffset(32)]
+		internal long fragmentedSize;
+		[FieldOffset(40)]
+		internal float pauseDuration;
+		[FieldOffset(44)]
+		internal fixed int collections[3];
+	}
+
+	internal static unsafe class Profiler {
+		private static Telemetry* telemetry;
+		private static long lastAllocatedBytes;
+		private static TimeSpan lastPauseDuration;
+		private static int lastGen0Collections;
+		private static int lastGen1Collections;
+		private static int lastGen2Collections;
+
+		internal static void Initialize(IntPtr pointer) {
+			telemetry = (Telemetry*)pointer;
+			lastAllocatedBytes = GC.GetTotalAllocatedBytes(false);
+			lastPauseDuration = GC.GetTotalPauseDuration();
+			lastGen0Collections = GC.CollectionCount(0);
+			lastGen1Collections = GC.CollectionCount(1);
+			lastGen2Collections = GC.CollectionCount(2);
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static long BeginExecute() => GC.GetAllocatedBytesForCurrentThread();
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static void EndExecute(long allocatedBytes) => telemetry->executeAllocatedBytes = GC.GetAllocatedBytesForCurrentThread() - allocatedBytes;
+
+		internal static void Sample() {
+			long allocatedBytes = GC.GetTotalAllocatedBytes(false);
+			TimeSpan pauseDuration = GC.GetTotalPauseDuration();
+			int gen0Collections = GC.CollectionCount(0);
+			int gen1Collections = GC.CollectionCount(1);
+			int gen2Collections = GC.CollectionCount(2);
+			GCMemoryInfo memoryInfo = GC.GetGCMemoryInfo();
+
+			telemetry->frameAllocatedBytes = allocatedBytes - lastAllocatedBytes;
+			telemetry->heapSize = memoryInfo.HeapSizeBytes;
+			telemetry->committedSize = memoryInfo.TotalCommittedBytes;
+			telemetry->fragmentedSize = memoryInfo.FragmentedBytes;
+			telemetry->pauseDuration = (float)(pauseDuration - lastPauseDuration).TotalMilliseconds;
+			telemetry->collections[0] = gen0Collections - lastGen0Collections;
+			telemetry->collections[1] = gen1Collections - lastGen1Collections;
+			telemetry->collections[2] = gen2Collections - lastGen2Collections;
+
+			lastAllocatedBytes = allocatedBytes;
+			lastPauseDuration = pauseDuration;
+			lastGen0Collections = gen0Collections;
+			lastGen1Collections = gen1Collections;
+			lastGen2Collections = gen2Collections;
+		}
+	}
+
+	[EventSource(Name = "UnrealCLR")]
+	internal sealed class FrameEventSource : EventSource {
+		internal static readonly FrameEventSource Log = new();
+
+		[Event(1, Level = EventLevel.Informational)]
+		public void Frame(uint frameNumber) => WriteEvent(1, frameNumber);
+	}
+
+	internal static class Tracing {
+		private const long runtimeKeywords = 0x1 | 0x8 | 0x10; // GC, Loader, JIT
+		private static EventPipeSession session;
+		private static FileStream fileStream;
+		private static Task copyTask;
+
+		internal static bool Start(string path) {
+			if (session != null)
+				return false;
+
+			EventPipeProvider[] providers = {
+				new("Microsoft-DotNETCore-SampleProfiler", EventLevel.Informational),
+				new("Microsoft-Windows-DotNETRuntime", EventLevel.Informational, runtimeKeywords),
+				new(FrameEventSource.Log.Name, EventLevel.Informational)
+			};
+
+			fileStream = new(path, FileMode.Create, FileAccess.Write);
+
+			try {
+				session = new DiagnosticsClient(Environment.ProcessId).StartEventPipeSession(providers, requestRundown: true);
+			}
+
+			catch {
+				fileStream.Dispose();
+				fileStream = null;
+
+				throw;
+			}
+
+			copyTask = session.EventStream.CopyToAsync(fileStream);
+
+			return true;
+		}
+
+		internal static void Stop() {
+			if (session == null)
+				return;
+
+			// Rundown events required to resolve managed frames are written after the stop request
+
+			session.Stop();
+			copyTask.Wait();
+			session.Dispose();
+			fileStream.Dispose();
+
+			session = null;
+			fileStream = null;
+			copyTask = null;
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static void Frame(uint frameNumber) => FrameEventSource.Log.Frame(frameNumber);
+	}
+
 	internal sealed class Plugin {
+		internal string path;
 		internal PluginLoader loader;
 		internal Assembly assembly;
 		internal Dictionary<int, IntPtr> userFunctions;
@@ -131,20 +273,356 @@ namespace UnrealEngine.Runtime {
 		internal void UnloadAssembliesContext() => assembliesContext?.Unload();
 	}
 
+	internal static class GarbageCollector {
+		private static readonly GCLatencyMode latencyMode = GetLatencyMode("UnrealCLR.GC.LatencyMode", GCLatencyMode.SustainedLowLatency);
+		private static readonly long noGCRegionSize = GetSetting("UnrealCLR.GC.NoGCRegionSize", 0L);
+		private static readonly long idleAllocationThreshold = GetSetting("UnrealCLR.GC.IdleAllocationThreshold", 1L << 20);
+		private static readonly float idleBudget = GetSetting("UnrealCLR.GC.IdleBudget", 1.0f);
+		private static GCLatencyMode defaultLatencyMode;
+		private static long lastIdleAllocatedBytes;
+		private static bool active;
+
+		internal static T GetSetting<T>(string name, T defaultValue) where T : IParsable<T> => AppContext.GetData(name) is string value && T.TryParse(value, CultureInfo.InvariantCulture, out T result) ? result : defaultValue;
+
+		private static GCLatencyMode GetLatencyMode(string name, GCLatencyMode defaultValue) => AppContext.GetData(name) is string value && Enum.TryParse(value, true, out GCLatencyMode result) && result != GCLatencyMode.NoGCRegion ? result : defaultValue;
+
+		internal static void Begin() {
+			Collect();
+
+			defaultLatencyMode = GCSettings.LatencyMode;
+			GCSettings.LatencyMode = latencyMode;
+			lastIdleAllocatedBytes = GC.GetTotalAllocatedBytes(false);
+			active = true;
+
+			StartNoGCRegion();
+		}
+
+		internal static void End() {
+			if (!active)
+				return;
+
+			EndNoGCRegion();
+
+			GCSettings.LatencyMode = defaultLatencyMode;
+			active = false;
+		}
+
+		internal static void Idle(float budget) {
+			if (!active)
+				return;
+
+			EndNoGCRegion();
+
+			long allocatedBytes = GC.GetTotalAllocatedBytes(false);
+
+			if (budget >= idleBudget && allocatedBytes - lastIdleAllocatedBytes >= idleAllocationThreshold) {
+				GC.Collect(budget >= idleBudget * 4.0f ? 1 : 0, GCCollectionMode.Forced, true, false);
+
+				lastIdleAllocatedBytes = allocatedBytes;
+			}
+
+			StartNoGCRegion();
+		}
+
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		internal static void Collect() {
+			GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
+			GC.WaitForPendingFinalizers();
+		}
+
+		private static void StartNoGCRegion() {
+			if (noGCRegionSize <= 0 || GCSettings.LatencyMode == GCLatencyMode.NoGCRegion)
+				return;
+
+			try {
+				GC.TryStartNoGCRegion(noGCRegionSize, true);
+			}
+
+			catch (ArgumentOutOfRangeException) { }
+		}
+
+		private static void EndNoGCRegion() {
+			if (GCSettings.LatencyMode != GCLatencyMode.NoGCRegion)
+				return;
+
+			try {
+				GC.EndNoGCRegion();
+			}
+
+			catch (InvalidOperationException) { }
+		}
+	}
+
+	internal sealed class JitEventListener : EventListener {
+		private const long jitKeyword = 0x10;
+		private readonly object syncRoot = new();
+		private readonly HashSet<string> methods = new(StringComparer.Ordinal);
+
+		protected override void OnEventSourceCreated(EventSource eventSource) {
+			if (eventSource.Name == "Microsoft-Windows-DotNETRuntime")
+				EnableEvents(eventSource, EventLevel.Verbose, (EventKeywords)jitKeyword);
+		}
+
+		protected override void OnEventWritten(EventWrittenEventArgs eventData) {
+			if (eventData.EventName == null || !eventData.EventName.StartsWith("MethodLoadVerbose", StringComparison.Ordinal))
+				return;
+
+			int namespaceIndex = eventData.PayloadNames.IndexOf("MethodNamespace");
+			int nameIndex = eventData.PayloadNames.IndexOf("MethodName");
+
+			if (namespaceIndex < 0 || nameIndex < 0)
+				return;
+
+			lock (syncRoot) {
+				methods.Add(eventData.Payload[namespaceIndex] + "|" + eventData.Payload[nameIndex]);
+			}
+		}
+
+		internal string[] GetMethods() {
+			lock (syncRoot) {
+				return methods.ToArray();
+			}
+		}
+	}
+
+	internal static class Warmup {
+		private static readonly bool enabled = GarbageCollector.GetSetting("UnrealCLR.Warmup.Enabled", true);
+		private static readonly float recordingDuration = GarbageCollector.GetSetting("UnrealCLR.Warmup.RecordingDuration", 30.0f);
+		private static readonly OpCode[] oneByteOpCodes = new OpCode[0x100];
+		private static readonly OpCode[] twoByteOpCodes = new OpCode[0x100];
+		private static readonly Stopwatch recordingTime = new();
+		private static Task task;
+		private static Task recordTask;
+		private static JitEventListener listener;
+		private static Action<LogLevel, string> log;
+		private static Assembly[] assemblies;
+		private static string[] hotMethods;
+		private static string hotMethodsPath;
+
+		static Warmup() {
+			foreach (FieldInfo field in typeof(OpCodes).GetFields(BindingFlags.Public | BindingFlags.Static)) {
+				OpCode opCode = (OpCode)field.GetValue(null);
+				ushort value = unchecked((ushort)opCode.Value);
+
+				if (opCode.Size == 1)
+					oneByteOpCodes[value] = opCode;
+				else
+					twoByteOpCodes[value & 0xFF] = opCode;
+			}
+		}
+
+		internal static void Start(IEnumerable<MethodInfo> entryPoints, Assembly framework, IEnumerable<Assembly> pluginAssemblies, string path, Action<LogLevel, string> log) {
+			if (!enabled)
+				return;
+
+			assemblies = pluginAssemblies.Append(framework).Append(typeof(object).Assembly).ToArray();
+			hotMethodsPath = path;
+			Warmup.log = log;
+
+			MethodInfo[] methods = entryPoints.ToArray();
+
+			// Compilation runs on worker threads while the engine finishes loading the world, user code is not executed until it's completed
+
+			task = Task.Factory.StartNew(() => {
+				Stopwatch stopwatch = Stopwatch.StartNew();
+				string[] recordedMethods = Array.Empty<string>();
+
+				try {
+					if (File.Exists(hotMethodsPath))
+						recordedMethods = File.ReadAllLines(hotMethodsPath);
+				}
+
+				catch (Exception exception) {
+					log(LogLevel.Warning, "Warmup failed to read recorded hot methods from " + hotMethodsPath + "\r\n" + exception.ToString());
+				}
+
+				HashSet<MethodBase> targets = new();
+
+				foreach (MethodInfo method in methods) {
+					targets.Add(method);
+					AddCallees(method, framework, targets);
+				}
+
+				hotMethods = recordedMethods;
+
+				foreach (string hotMethod in hotMethods) {
+					foreach (MethodBase method in Resolve(hotMethod)) {
+						targets.Add(method);
+					}
+				}
+
+				int prepared = 0;
+
+				Parallel.ForEach(targets, method => {
+					try {
+						RuntimeHelpers.PrepareMethod(method.MethodHandle);
+						Interlocked.Increment(ref prepared);
+					}
+
+					catch (Exception) { }
+				});
+
+				log(LogLevel.Display, "Warmup compiled " + prepared + " methods of " + methods.Length + " entry points and " + hotMethods.Length + " recorded hot methods in " + stopwatch.ElapsedMilliseconds + " ms");
+
+				listener = new();
+				recordingTime.Restart();
+			}, CancellationToken.None, TaskCreationOptions.LongRunning, TaskScheduler.Default);
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static void Wait() {
+			if (task != null)
+				Complete();
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static void Update() {
+			if (listener != null && recordingTime.Elapsed.TotalSeconds > recordingDuration)
+				StopRecording();
+		}
+
+		internal static void Stop() {
+			Wait();
+
+			if (listener != null)
+				StopRecording();
+
+			recordTask?.Wait();
+			recordTask = null;
+			assemblies = null;
+			hotMethods = null;
+			log = null;
+		}
+
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static void Complete() {
+			try {
+				task.Wait();
+			}
+
+			catch (AggregateException exception) {
+				log(LogLevel.Warning, "Warmup failed\r\n" + exception.InnerException.ToString());
+			}
+
+			task = null;
+		}
+
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static void StopRecording() {
+			JitEventListener recordedListener = listener;
+
+			listener = null;
+			recordingTime.Reset();
+			recordedListener.Dispose();
+
+			// Entries of previous sessions are kept while they can be resolved, since prepared methods are not compiled again and can't be recorded
+
+			recordTask = Task.Run(() => {
+				try {
+					string[] recorded = hotMethods.Union(recordedListener.GetMethods(), StringComparer.Ordinal).Where(hotMethod => Resolve(hotMethod).Any()).OrderBy(hotMethod => hotMethod, StringComparer.Ordinal).ToArray();
+
+					Directory.CreateDirectory(Path.GetDirectoryName(hotMethodsPath));
+					File.WriteAllLines(hotMethodsPath, recorded);
+				}
+
+				catch (Exception exception) {
+					log(LogLevel.Warning, "Warmup failed to write recorded hot methods to " + hotMethodsPath + "\r\n" + exception.ToString());
+				}
+			});
+		}
+
+		private static IEnumerable<MethodBase> Resolve(string hotMethod) {
+			int separator = hotMethod.IndexOf('|', StringComparison.Ordinal);
+
+			if (separator < 0)
+				yield break;
+
+			string typeName = hotMethod.Substring(0, separator);
+			string methodName = hotMethod.Substring(separator + 1);
+			Type type = null;
+
+			foreach (Assembly assembly in assemblies) {
+				if ((type = assembly.GetType(typeName, false)) != null)
+					break;
+			}
+
+			if (type == null || type.ContainsGenericParameters)
+				yield break;
+
+			const BindingFlags flags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static | BindingFlags.DeclaredOnly;
+
+			foreach (MethodBase method in methodName == ConstructorInfo.ConstructorName ? (IEnumerable<MethodBase>)type.GetConstructors(flags) : type.GetMethods(flags).Where(method => method.Name == methodName)) {
+				if (!method.IsAbstract && !method.ContainsGenericParameters)
+					yield return method;
+			}
+		}
+
+		private static void AddCallees(MethodInfo method, Assembly framework, HashSet<MethodBase> targets) {
+			byte[] il;
+
+			try {
+				il = method.GetMethodBody()?.GetILAsByteArray();
+			}
+
+			catch (Exception) {
+				return;
+			}
+
+			if (il == null)
+				return;
+
+			Type[] typeArguments = method.DeclaringType.IsGenericType ? method.DeclaringType.GetGenericArguments() : null;
+			Type[] methodArguments = method.IsGenericMethod ? method.GetGenericArguments() : null;
+			int position = 0;
+
+			while (position < il.Length) {
+				OpCode opCode = il[position] == 0xFE && position + 1 < il.Length ? twoByteOpCodes[il[++position]] : oneByteOpCodes[il[position]];
+
+				position++;
+
+				if (opCode.OperandType == OperandType.InlineMethod && position + 4 <= il.Length) {
+					try {
+						MethodBase callee = method.Module.ResolveMethod(BitConverter.ToInt32(il, position), typeArguments, methodArguments);
+
+						if (callee.DeclaringType?.Assembly == framework && !callee.IsAbstract && !callee.ContainsGenericParameters)
+							targets.Add(callee);
+					}
+
+					catch (Exception) { }
+				}
+
+				position += opCode.OperandType switch {
+					OperandType.InlineNone => 0,
+					OperandType.ShortInlineBrTarget or OperandType.ShortInlineI or OperandType.ShortInlineVar => 1,
+					OperandType.InlineVar => 2,
+					OperandType.InlineI8 or OperandType.InlineR => 8,
+					OperandType.InlineSwitch when position + 4 <= il.Length => 4 + BitConverter.ToInt32(il, position) * 4,
+					_ => 4
+				};
+			}
+		}
+	}
+
 	internal static unsafe class Core {
 		private static AssembliesContextManager assembliesContextManager;
 		private static WeakReference assembliesContextWeakReference;
-		private static Plugin plugin;
-		private static IntPtr sharedEvents;
+		private const int eventsCount = 128;
+		private static readonly List<Plugin> plugins = new();
+		private static readonly Dictionary<int, IntPtr> userFunctions = new();
 		private static IntPtr sharedFunctions;
 		private static int sharedChecksum;
 
 		private static delegate* unmanaged[Cdecl]<string, void> Exception;
 		private static delegate* unmanaged[Cdecl]<LogLevel, string, void> Log;
+		private static delegate* unmanaged[Cdecl]<int, IntPtr, void> RegisterEvent;
 
 		[UnmanagedCallersOnly]
 		internal static unsafe IntPtr ManagedCommand(Command command) {
 			if (command.type == CommandType.Execute) {
+				Warmup.Wait();
+
+				long allocatedBytes = Profiler.BeginExecute();
+
 				try {
 					switch (command.value.type) {
 						case ArgumentType.None: {
@@ -194,6 +672,43 @@ namespace UnrealEngine.Runtime {
 					}
 				}
 
+				Profiler.EndExecute(allocatedBytes);
+
+				return default;
+			}
+
+			if (command.type == CommandType.Idle) {
+				try {
+					GarbageCollector.Idle(command.value.single);
+					Profiler.Sample();
+					Warmup.Update();
+				}
+
+				catch (Exception exception) {
+					Exception(exception.ToString());
+				}
+
+				return default;
+			}
+
+			if (command.type == CommandType.Frame) {
+				Tracing.Frame(command.value.integer);
+
+				return default;
+			}
+
+			if (command.type == CommandType.Trace) {
+				try {
+					if (command.value.type == ArgumentType.Pointer)
+						return new(Tracing.Start(Marshal.PtrToStringUTF8(command.value.pointer)) ? 1 : 0);
+
+					Tracing.Stop();
+				}
+
+				catch (Exception exception) {
+					Log(LogLevel.Error, "Trace session failed\r\n" + exception.ToString());
+				}
+
 				return default;
 			}
 
@@ -203,7 +718,7 @@ namespace UnrealEngine.Runtime {
 				try {
 					string method = Marshal.PtrToStringAnsi(command.method);
 
-					if (!plugin.userFunctions.TryGetValue(method.GetHashCode(StringComparison.Ordinal), out function) && command.optional != 1)
+					if (!userFunctions.TryGetValue(method.GetHashCode(StringComparison.Ordinal), out function) && command.optional != 1)
 						Log(LogLevel.Error, "Managed function was not found \"" + method + "\"");
 				}
 
@@ -228,11 +743,13 @@ namespace UnrealEngine.Runtime {
 
 						Exception = (delegate* unmanaged[Cdecl]<string, void>)runtimeFunctions[head++];
 						Log = (delegate* unmanaged[Cdecl]<LogLevel, string, void>)runtimeFunctions[head++];
+						RegisterEvent = (delegate* unmanaged[Cdecl]<int, IntPtr, void>)runtimeFunctions[head++];
 					}
 
-					sharedEvents = buffer[position++];
 					sharedFunctions = buffer[position++];
 					sharedChecksum = command.checksum;
+
+					Profiler.Initialize(buffer[position++]);
 				}
 
 				catch (Exception exception) {
@@ -244,71 +761,96 @@ namespace UnrealEngine.Runtime {
 
 			if (command.type == CommandType.LoadAssemblies) {
 				try {
-					
 					const string frameworkAssemblyName = "UnrealEngine.Framework";
 					string assemblyPath = Assembly.GetExecutingAssembly().Location;
-					string managedFolder = assemblyPath.Substring(0, assemblyPath.IndexOf("Plugins", StringComparison.Ordinal)) + "Managed";
-					string[] folders = Directory.GetDirectories(managedFolder);
+					string projectFolder = assemblyPath.Substring(0, assemblyPath.IndexOf("Plugins", StringComparison.Ordinal));
+					string managedFolder = projectFolder + "Managed";
+					string[] assemblies = Directory.EnumerateFiles(managedFolder, "*.dll", SearchOption.AllDirectories).Where(assembly => Path.GetFileNameWithoutExtension(assembly) != frameworkAssemblyName).OrderBy(assembly => assembly, StringComparer.Ordinal).ToArray();
+					bool[] referencesFramework = new bool[assemblies.Length];
 
-					Array.Resize(ref folders, folders.Length + 1);
+					Parallel.For(0, assemblies.Length, index => referencesFramework[index] = IsReferencingAssembly(assemblies[index], frameworkAssemblyName));
 
-					folders[folders.Length - 1] = managedFolder;
+					List<string> pluginAssemblies = new();
 
-					foreach (string folder in folders) {
-						IEnumerable<string> assemblies = Directory.EnumerateFiles(folder, "*.dll", SearchOption.AllDirectories);
+					for (int i = 0; i < assemblies.Length; i++) {
+						if (referencesFramework[i])
+							pluginAssemblies.Add(assemblies[i]);
+					}
 
-						foreach (string assembly in assemblies) {
-							AssemblyName name = null;
-							bool loadingFailed = false;
+					if (pluginAssemblies.Count == 0)
+						return default;
 
-							try {
-								name = AssemblyName.GetAssemblyName(assembly);
-							}
+					AssemblyName frameworkName = new(frameworkAssemblyName);
+					AssemblyLoadContext assembliesContext = assembliesContextManager.assembliesContext;
+					Assembly framework = assembliesContext.LoadFromStream(new MemoryStream(File.ReadAllBytes(Path.Combine(Path.GetDirectoryName(pluginAssemblies[0]), frameworkAssemblyName + ".dll"))));
+					Type sharedClass = framework.GetType(frameworkAssemblyName + ".Shared");
+					int checksum = (int)sharedClass.GetField("checksum", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null);
 
-							catch (BadImageFormatException) {
-								continue;
-							}
+					if (checksum != sharedChecksum) {
+						Log(LogLevel.Fatal, "Framework loading failed, version is incompatible with the runtime, please, recompile the project with an updated version referenced in " + pluginAssemblies[0] + " checksum:" + checksum + " sharedChecksum:" + sharedChecksum);
+						UnloadAssemblies();
 
-							if (name?.Name != frameworkAssemblyName) {
-								plugin = new();
-								plugin.loader = PluginLoader.CreateFromAssemblyFile(assembly, config => { config.DefaultContext = assembliesContextManager.assembliesContext; config.IsUnloadable = true; config.LoadInMemory = true; });
-								plugin.assembly = plugin.loader.LoadAssemblyFromPath(assembly);
+						return default;
+					}
+
+					Plugin[] loadedPlugins = new Plugin[pluginAssemblies.Count];
+					Exception[] loadingExceptions = new Exception[pluginAssemblies.Count];
 
-								AssemblyName[] referencedAssemblies = plugin.assembly.GetReferencedAssemblies();
+					Parallel.For(0, pluginAssemblies.Count, index => {
+						try {
+							Plugin plugin = new();
 
-								foreach (AssemblyName referencedAssembly in referencedAssemblies) {
-									if (referencedAssembly.Name == frameworkAssemblyName) {
-										Assembly framework = plugin.loader.LoadAssembly(referencedAssembly);
+							plugin.path = pluginAssemblies[index];
+							plugin.loader = PluginLoader.CreateFromAssemblyFile(plugin.path, config => { config.DefaultContext = assembliesContext; config.IsUnloadable = true; config.LoadInMemory = true; config.SharedAssemblies.Add(frameworkName); });
+							plugin.assembly = plugin.loader.LoadAssemblyFromPath(plugin.path);
 
-										using (assembliesContextManager.assembliesContext.EnterContextualReflection()) {
-											Type sharedClass = framework.GetType(frameworkAssemblyName + ".Shared");
+							loadedPlugins[index] = plugin;
+						}
 
-											var checksum = (int)sharedClass.GetField("checksum", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null);
-											
-											if (checksum == sharedChecksum) {
-												Log(LogLevel.Display, "A6" + checksum);
+						catch (Exception exception) {
+							loadingExceptions[index] = exception;
+						}
+					});
 
-                                                plugin.userFunctions = (Dictionary<int, IntPtr>)sharedClass.GetMethod("Load", BindingFlags.NonPublic | BindingFlags.Static).Invoke(null, new object[] { sharedEvents, sharedFunctions, plugin.assembly });
+					MethodInfo load = sharedClass.GetMethod("Load", BindingFlags.NonPublic | BindingFlags.Static);
+					IntPtr* events = stackalloc IntPtr[eventsCount];
 
-												Log(LogLevel.Display, "Framework loaded succesfuly for " + assembly);
+					using (assembliesContext.EnterContextualReflection()) {
+						for (int i = 0; i < loadedPlugins.Length; i++) {
+							Plugin plugin = loadedPlugins[i];
+
+							if (plugin == null) {
+								Exception("Loading of assembly failed " + pluginAssemblies[i] + "\r\n" + loadingExceptions[i].ToString());
+
+								continue;
+							}
 
-												return default;
-											} else {
-												Log(LogLevel.Fatal, "Framework loading failed, version is incompatible with the runtime, please, recompile the project with an updated version referenced in " + assembly + " checksum:" + checksum + " sharedChecksum:" + sharedChecksum);
+							new Span<IntPtr>(events, eventsCount).Clear();
 
-												loadingFailed = true;
-											}
-										}
-									}
-								}
+							plugin.userFunctions = (Dictionary<int, IntPtr>)load.Invoke(null, new object[] { (IntPtr)events, sharedFunctions, plugin.assembly });
 
-								UnloadAssemblies();
+							for (int index = 0; index < eventsCount; index++) {
+								if (events[index] != IntPtr.Zero)
+									RegisterEvent(index, events[index]);
+							}
 
-								if (loadingFailed)
-									return default;
+							foreach (KeyValuePair<int, IntPtr> userFunction in plugin.userFunctions) {
+								if (!userFunctions.TryAdd(userFunction.Key, userFunction.Value))
+									Log(LogLevel.Warning, "Managed function with the same name is already loaded, ignoring the one in " + plugin.path);
 							}
+
+							plugins.Add(plugin);
+
+							Log(LogLevel.Display, "Framework loaded succesfuly for " + plugin.path);
 						}
 					}
+
+					if (plugins.Count > 0) {
+						GarbageCollector.Begin();
+						Warmup.Start((List<MethodInfo>)sharedClass.GetField("entryPoints", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null), framework, plugins.Select(plugin => plugin.assembly), Path.Combine(projectFolder, "Saved", "UnrealCLR", "HotMethods.txt"), (level, message) => Log(level, message));
+					} else {
+						UnloadAssemblies();
+					}
 				}
 
 				catch (Exception exception) {
@@ -325,19 +867,48 @@ namespace UnrealEngine.Runtime {
 			return default;
 		}
 
+		private static bool IsReferencingAssembly(string path, string assemblyName) {
+			try {
+				using FileStream stream = File.OpenRead(path);
+				using PEReader reader = new(stream);
+
+				if (!reader.HasMetadata)
+					return false;
+
+				MetadataReader metadata = reader.GetMetadataReader();
+
+				if (!metadata.IsAssembly)
+					return false;
+
+				foreach (AssemblyReferenceHandle handle in metadata.AssemblyReferences) {
+					if (metadata.StringComparer.Equals(metadata.GetAssemblyReference(handle).Name, assemblyName))
+						return true;
+				}
+			}
+
+			catch (BadImageFormatException) { }
+
+			return false;
+		}
+
 		[MethodImpl(MethodImplOptions.NoInlining)]
 		private static void UnloadAssemblies() {
 			try {
-				plugin?.loader.Dispose();
-				plugin = null;
+				GarbageCollector.End();
+				Warmup.Stop();
+
+				foreach (Plugin plugin in plugins) {
+					plugin.loader.Dispose();
+				}
+
+				plugins.Clear();
+				userFunctions.Clear();
 
 				assembliesContextManager.UnloadAssembliesContext();
 				assembliesContextManager = null;
 
-				if (assembliesContextWeakReference.IsAlive) {
-					GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
-					GC.WaitForPendingFinalizers();
-				}
+				if (assembliesContextWeakReference.IsAlive)
+					GarbageCollector.Collect();
 
 				assembliesContextManager = new();
 				assembliesContextWeakReference = assembliesContextManager.CreateAssembliesContext();
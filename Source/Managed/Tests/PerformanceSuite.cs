@@ -0,0 +1,497 @@
+using System.Globalization;
+using System.IO;
+using System.Text;
+using Stopwatch = System.Diagnostics.Stopwatch;
+
+namespace UnrealEngine.Tests {
+	public class PerformanceSuite : ISystem {
+		private const int warmupFrames = 60;
+		private const int sampleFrames = 600;
+		private const double defaultTolerance = 0.1;
+		private const string header = "Scenario,Frames,FrameP50Ms,FrameP90Ms,FrameP99Ms,FrameMaxMs,TickP50Ms,TickP99Ms,InteropCallsPerFrame,InteropCallsMax";
+		private static readonly string[] thresholds = { "FrameP99Ms", "TickP99Ms", "InteropCallsPerFrame" };
+		private readonly List<ISystem> scenarios = new();
+		private readonly List<string> results = new();
+		private readonly double[] frameTimes = new double[sampleFrames];
+		private readonly double[] tickTimes = new double[sampleFrames];
+		private readonly long[] interopCalls = new long[sampleFrames];
+		private int scenarioIndex;
+		private int frame;
+		private long lastTimestamp;
+		private long lastInteropCalls;
+
+		public PerformanceSuite() {
+			scenarios.Add(new ActorPropertyReads(2000));
+			scenarios.Add(new InstanceTransformUpdates(100000));
+			scenarios.Add(new TraceBatches(10000));
+			scenarios.Add(new OverlapStorm(400));
+			scenarios.Add(new StringLogging(2000));
+			scenarios.Add(new SpawnDestroyCycles(200));
+			scenarios.Add(new IndexedActorLookups(50000, 1000));
+			scenarios.Add(new ScannedActorLookups(50000, 1000));
+
+			// A single scenario can be selected with -PerformanceScenario=Name
+
+			if (CommandLine.TryGetValue("PerformanceScenario", out string scenario))
+				scenarios.RemoveAll(system => !system.GetType().Name.Equals(scenario, StringComparison.OrdinalIgnoreCase));
+		}
+
+		public void OnBeginPlay() {
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			if (scenarios.Count == 0) {
+				Debug.Log(LogLevel.Error, "No performance scenarios to run");
+
+				Complete();
+
+				return;
+			}
+
+			BeginScenario();
+		}
+
+		public void OnTick(float deltaTime) {
+			if (scenarioIndex >= scenarios.Count)
+				return;
+
+			long timestamp = Stopwatch.GetTimestamp();
+			long calls = Application.InteropCalls;
+			int sample = frame++ - warmupFrames;
+
+			if (sample >= 0) {
+				frameTimes[sample] = Stopwatch.GetElapsedTime(lastTimestamp, timestamp).TotalMilliseconds;
+				interopCalls[sample] = calls - lastInteropCalls;
+			}
+
+			scenarios[scenarioIndex].OnTick(deltaTime);
+
+			if (sample >= 0)
+				tickTimes[sample] = Stopwatch.GetElapsedTime(timestamp).TotalMilliseconds;
+
+			lastTimestamp = timestamp;
+			lastInteropCalls = calls;
+
+			if (sample + 1 < sampleFrames)
+				return;
+
+			EndScenario();
+
+			if (++scenarioIndex < scenarios.Count)
+				BeginScenario();
+			else
+				Complete();
+		}
+
+		public void OnEndPlay() {
+			if (scenarioIndex < scenarios.Count)
+				scenarios[scenarioIndex].OnEndPlay();
+
+			Debug.ClearOnScreenMessages();
+		}
+
+		private void BeginScenario() {
+			ISystem scenario = scenarios[scenarioIndex];
+
+			Debug.Log(LogLevel.Display, "Starting " + scenario.GetType().Name + " scenario...");
+			Debug.AddOnScreenMessage(-1, 5.0f, Color.LightGreen, scenario.GetType().Name + " scenario started!");
+
+			frame = 0;
+			scenario.OnBeginPlay();
+		}
+
+		private void EndScenario() {
+			ISystem scenario = scenarios[scenarioIndex];
+			long totalCalls = 0;
+			long maxCalls = 0;
+
+			scenario.OnEndPlay();
+
+			foreach (long calls in interopCalls) {
+				totalCalls += calls;
+				maxCalls = Math.Max(maxCalls, calls);
+			}
+
+			Array.Sort(frameTimes);
+			Array.Sort(tickTimes);
+
+			string result = string.Join(",", scenario.GetType().Name, sampleFrames.ToString(CultureInfo.InvariantCulture), Format(GetPercentile(frameTimes, 0.5)), Format(GetPercentile(frameTimes, 0.9)), Format(GetPercentile(frameTimes, 0.99)), Format(frameTimes[^1]), Format(GetPercentile(tickTimes, 0.5)), Format(GetPercentile(tickTimes, 0.99)), Format((double)totalCalls / sampleFrames), maxCalls.ToString(CultureInfo.InvariantCulture));
+
+			results.Add(result);
+
+			Debug.Log(LogLevel.Display, header);
+			Debug.Log(LogLevel.Display, result);
+		}
+
+		private void Complete() {
+			string directory = Path.Combine(Application.ProjectDirectory, "Saved", "UnrealCLR");
+			string resultsPath = CommandLine.TryGetValue("PerformanceCsv", out string path) ? path : Path.Combine(directory, "Performance.csv");
+			string baselinePath = CommandLine.TryGetValue("PerformanceBaseline", out path) ? path : Path.Combine(directory, "PerformanceBaseline.csv");
+			double tolerance = CommandLine.TryGetValue("PerformanceTolerance", out string value) ? double.Parse(value, CultureInfo.InvariantCulture) : defaultTolerance;
+			int regressions = 0;
+
+			WriteResults(resultsPath);
+
+			Debug.Log(LogLevel.Display, "Performance results are written to " + resultsPath);
+
+			if (CommandLine.HasSwitch("PerformanceUpdateBaseline")) {
+				WriteResults(baselinePath);
+
+				Debug.Log(LogLevel.Display, "Performance baseline is updated at " + baselinePath);
+			} else if (File.Exists(baselinePath)) {
+				regressions = CompareResults(baselinePath, tolerance);
+			} else {
+				Debug.Log(LogLevel.Warning, "Performance baseline is not found at " + baselinePath + ", run with -PerformanceUpdateBaseline to create it");
+			}
+
+			if (regressions > 0) {
+				Debug.Log(LogLevel.Error, "Performance suite failed with " + regressions + " regressions");
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.OrangeRed, "Performance suite failed with " + regressions + " regressions, see output log");
+			} else {
+				Debug.Log(LogLevel.Display, "Performance suite passed");
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.LightGreen, "Performance suite passed!");
+			}
+
+			if (CommandLine.HasSwitch("Unattended"))
+				Application.RequestExit(returnCode: regressions > 0 ? 1 : 0);
+		}
+
+		private void WriteResults(string path) {
+			StringBuilder builder = new();
+
+			builder.AppendLine(header);
+
+			foreach (string result in results) {
+				builder.AppendLine(result);
+			}
+
+			Directory.CreateDirectory(Path.GetDirectoryName(Path.GetFullPath(path)));
+			File.WriteAllText(path, builder.ToString());
+		}
+
+		private int CompareResults(string baselinePath, double tolerance) {
+			string[] columns = header.Split(',');
+			Dictionary<string, string[]> baseline = new();
+			int regressions = 0;
+
+			foreach (string line in File.ReadLines(baselinePath)) {
+				string[] values = line.Split(',');
+
+				if (values.Length == columns.Length && values[0] != columns[0])
+					baseline[values[0]] = values;
+			}
+
+			foreach (string result in results) {
+				string[] values = result.Split(',');
+
+				if (!baseline.TryGetValue(values[0], out string[] baselineValues)) {
+					Debug.Log(LogLevel.Warning, values[0] + " scenario is not found in the baseline");
+
+					continue;
+				}
+
+				foreach (string threshold in thresholds) {
+					int column = Array.IndexOf(columns, threshold);
+					double current = double.Parse(values[column], CultureInfo.InvariantCulture);
+					double limit = double.Parse(baselineValues[column], CultureInfo.InvariantCulture) * (1.0 + tolerance);
+
+					if (current > limit) {
+						regressions++;
+
+						Debug.Log(LogLevel.Error, values[0] + " scenario regressed in " + threshold + ": " + values[column] + " exceeds " + Format(limit) + " of the baseline");
+					}
+				}
+			}
+
+			return regressions;
+		}
+
+		private static double GetPercentile(double[] sortedValues, double percentile) => sortedValues[Math.Clamp((int)Math.Ceiling(percentile * sortedValues.Length) - 1, 0, sortedValues.Length - 1)];
+
+		private static string Format(double value) => value.ToString("F3", CultureInfo.InvariantCulture);
+
+		private sealed class ActorPropertyReads : ISystem {
+			private readonly int count;
+			private Actor[] actors;
+			private SceneComponent[] sceneComponents;
+			private Transform transform;
+			private Vector3 accumulator;
+
+			public ActorPropertyReads(int count) => this.count = count;
+
+			public void OnBeginPlay() {
+				actors = new Actor[count];
+				sceneComponents = new SceneComponent[count];
+
+				for (int i = 0; i < count; i++) {
+					actors[i] = new("PerformanceActor" + i);
+					sceneComponents[i] = new(actors[i], setAsRoot: true);
+					sceneComponents[i].SetWorldLocation(new(100.0f * (i % 50), 100.0f * (i / 50), 0.0f));
+				}
+			}
+
+			public void OnTick(float deltaTime) {
+				accumulator = Vector3.Zero;
+
+				for (int i = 0; i < count; i++) {
+					sceneComponents[i].GetTransform(ref transform);
+
+					accumulator += sceneComponents[i].GetLocation();
+
+					if (actors[i].HasTag("Performance"))
+						accumulator += Vector3.One;
+				}
+			}
+
+			public void OnEndPlay() {
+				foreach (Actor actor in actors) {
+					actor.Destroy();
+				}
+			}
+		}
+
+		private sealed class InstanceTransformUpdates : ISystem {
+			private readonly int count;
+			private Actor actor;
+			private InstancedStaticMeshComponent instancedStaticMeshComponent;
+			private Transform[] transforms;
+			private float angle;
+
+			public InstanceTransformUpdates(int count) => this.count = count;
+
+			public void OnBeginPlay() {
+				int side = (int)Math.Ceiling(Math.Sqrt(count));
+
+				actor = new("PerformanceInstances");
+				instancedStaticMeshComponent = new(actor, setAsRoot: true);
+				transforms = new Transform[count];
+
+				for (int i = 0; i < count; i++) {
+					transforms[i] = new(new(150.0f * (i % side), 150.0f * (i / side), 0.0f), Quaternion.Identity, Vector3.One);
+				}
+
+				instancedStaticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				instancedStaticMeshComponent.AddInstances(transforms);
+			}
+
+			public void OnTick(float deltaTime) {
+				angle += deltaTime;
+
+				Quaternion rotation = Quaternion.CreateFromYawPitchRoll(angle, angle, 0.0f);
+
+				for (int i = 0; i < count; i++) {
+					transforms[i].Rotation = rotation;
+				}
+
+				instancedStaticMeshComponent.BatchUpdateInstanceTransforms(0, transforms, markRenderStateDirty: true);
+			}
+
+			public void OnEndPlay() => actor.Destroy();
+		}
+
+		private sealed class TraceBatches : ISystem {
+			private readonly int count;
+			private Actor floor;
+			private TraceBatch traceBatch;
+			private TraceQuery[] queries;
+
+			public TraceBatches(int count) => this.count = count;
+
+			public void OnBeginPlay() {
+				floor = new("PerformanceFloor");
+
+				StaticMeshComponent staticMeshComponent = new(floor, setAsRoot: true);
+
+				staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+				staticMeshComponent.SetWorldLocation(new(0.0f, 0.0f, -500.0f));
+				staticMeshComponent.SetWorldScale(new(100.0f, 100.0f, 1.0f));
+				staticMeshComponent.SetCollisionChannel(CollisionChannel.WorldStatic);
+
+				traceBatch = new(count);
+				queries = new TraceQuery[count];
+
+				Random random = new(count);
+
+				for (int i = 0; i < count; i++) {
+					Vector3 start = new((float)random.NextDouble() * 8000.0f - 4000.0f, (float)random.NextDouble() * 8000.0f - 4000.0f, 500.0f);
+
+					queries[i] = TraceQuery.CreateLine(start, start - new Vector3(0.0f, 0.0f, 2000.0f), CollisionChannel.WorldStatic);
+				}
+			}
+
+			public void OnTick(float deltaTime) {
+				traceBatch.Clear();
+
+				for (int i = 0; i < count; i++) {
+					traceBatch.Add(queries[i]);
+				}
+
+				traceBatch.Execute();
+			}
+
+			public void OnEndPlay() => floor.Destroy();
+		}
+
+		private sealed class OverlapStorm : ISystem {
+			private readonly int count;
+			private Actor[] actors;
+			private StaticMeshComponent[] staticMeshComponents;
+			private Vector3[] origins;
+			private float time;
+			private int overlaps;
+
+			public OverlapStorm(int count) => this.count = count;
+
+			public void OnBeginPlay() {
+				actors = new Actor[count];
+				staticMeshComponents = new StaticMeshComponent[count];
+				origins = new Vector3[count];
+
+				World.SetOnActorBeginOverlapCallback(OnActorOverlap);
+				World.SetOnActorEndOverlapCallback(OnActorOverlap);
+
+				// Neighbouring actors move in opposite directions and pass through each other every half a second
+
+				for (int i = 0; i < count; i++) {
+					origins[i] = new(300.0f * (i / 2 % 20), 300.0f * (i / 40), 0.0f);
+					actors[i] = new("PerformanceOverlap" + i);
+					staticMeshComponents[i] = new(actors[i], "PerformanceOverlapComponent" + i, true);
+					staticMeshComponents[i].SetStaticMesh(StaticMesh.Cube);
+					staticMeshComponents[i].SetCollisionProfileName("OverlapAllDynamic");
+					staticMeshComponents[i].SetGenerateOverlapEvents(true);
+					staticMeshComponents[i].SetWorldLocation(origins[i]);
+
+					actors[i].RegisterEvent(ActorEventType.OnActorBeginOverlap);
+					actors[i].RegisterEvent(ActorEventType.OnActorEndOverlap);
+				}
+			}
+
+			public void OnTick(float deltaTime) {
+				time += deltaTime;
+
+				float offset = MathF.Sin(time * MathF.PI * 2.0f) * 150.0f;
+
+				for (int i = 0; i < count; i++) {
+					staticMeshComponents[i].SetWorldLocation(origins[i] + new Vector3((i & 1) == 0 ? offset : -offset, 0.0f, 0.0f));
+				}
+			}
+
+			public void OnEndPlay() {
+				Debug.Log(LogLevel.Display, "Overlap events received: " + overlaps);
+
+				foreach (Actor actor in actors) {
+					actor.Destroy();
+				}
+			}
+
+			private void OnActorOverlap(ActorReference overlapActor, ActorReference otherActor) => overlaps++;
+		}
+
+		private sealed class StringLogging : ISystem {
+			private readonly int count;
+
+			public StringLogging(int count) => this.count = count;
+
+			public void OnTick(float deltaTime) {
+				for (int i = 0; i < count; i++) {
+					Debug.Log(LogLevel.Verbose, "Frame " + Engine.FrameNumber + " message " + i + " with delta time " + deltaTime.ToString(CultureInfo.InvariantCulture));
+				}
+
+				Debug.AddOnScreenMessage(1, 1.0f, Color.SkyBlue, "Frame number: " + Engine.FrameNumber);
+			}
+		}
+
+		private abstract class ActorLookups : ISystem {
+			private readonly int count;
+			private readonly int lookups;
+			private readonly bool indexed;
+			private readonly Random random = new(0);
+			private Actor[] actors;
+			private int found;
+
+			protected ActorLookups(int count, int lookups, bool indexed) {
+				this.count = count;
+				this.lookups = lookups;
+				this.indexed = indexed;
+			}
+
+			public void OnBeginPlay() {
+				ConsoleManager.FindVariable("clr.ActorIndex").SetInt(indexed ? 1 : 0);
+
+				actors = new Actor[count];
+
+				for (int i = 0; i < count; i++) {
+					actors[i] = new("LookupActor" + i);
+					actors[i].AddTag("LookupTag" + (i % 1000));
+				}
+			}
+
+			public void OnTick(float deltaTime) {
+				found = 0;
+
+				for (int i = 0; i < lookups; i++) {
+					int target = random.Next(count);
+
+					if (World.FindActor("LookupActor" + target).IsCreated)
+						found++;
+
+					if (World.FindActorByTag("LookupTag" + (target % 1000)).IsCreated)
+						found++;
+
+					if (World.FindActorByID(actors[target].ID).IsCreated)
+						found++;
+				}
+
+				if (found != lookups * 3)
+					Debug.Log(LogLevel.Error, "Found " + found + " of " + (lookups * 3) + " actors");
+			}
+
+			public void OnEndPlay() {
+				foreach (Actor actor in actors) {
+					actor.Destroy();
+				}
+
+				ConsoleManager.FindVariable("clr.ActorIndex").SetInt(1);
+			}
+		}
+
+		private sealed class IndexedActorLookups : ActorLookups {
+			public IndexedActorLookups(int count, int lookups) : base(count, lookups, true) { }
+		}
+
+		private sealed class ScannedActorLookups : ActorLookups {
+			public ScannedActorLookups(int count, int lookups) : base(count, lookups, false) { }
+		}
+
+		private sealed class SpawnDestroyCycles : ISystem {
+			private readonly int count;
+			private Actor[] actors;
+			private Material material;
+
+			public SpawnDestroyCycles(int count) => this.count = count;
+
+			public void OnBeginPlay() {
+				actors = new Actor[count];
+				material = Material.Load("/Game/Tests/BasicMaterial");
+			}
+
+			public void OnTick(float deltaTime) {
+				for (int i = 0; i < count; i++) {
+					actors[i]?.Destroy();
+					actors[i] = new();
+
+					StaticMeshComponent staticMeshComponent = new(actors[i], setAsRoot: true);
+
+					staticMeshComponent.SetStaticMesh(StaticMesh.Cube);
+					staticMeshComponent.SetMaterial(0, material);
+					staticMeshComponent.SetWorldLocation(new(150.0f * (i % 20), 150.0f * (i / 20), 0.0f));
+				}
+			}
+
+			public void OnEndPlay() {
+				foreach (Actor actor in actors) {
+					actor?.Destroy();
+				}
+			}
+		}
+	}
+}
@@ -1,5 +1,9 @@
 namespace UnrealEngine.Tests {
 	public class RuntimeConsistency : ISystem {
+		private readonly List<int> subscribersOrder = new();
+		private Subscription[] subscriptions;
+		private bool subscribersVerified;
+
 		public void OnBeginPlay() {
 			ActorMemoryManagementTest();
 			ComponentMemoryManagementTest();
@@ -8,10 +12,30 @@ namespace UnrealEngine.Tests {
 			DuplicateActorMemoryManagementTest();
 			DuplicateComponentMemoryManagementTest();
 			ConsoleVariablesMemoryManagementTest();
+			TickSubscribersOrderTest();
 
 			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, "Verify " + MethodBase.GetCurrentMethod().DeclaringType + " results in output log!");
 		}
 
+		public void OnTick(float deltaTime) {
+			if (subscribersVerified || subscribersOrder.Count == 0)
+				return;
+
+			subscribersVerified = true;
+
+			foreach (Subscription subscription in subscriptions) {
+				subscription.Dispose();
+			}
+
+			if (subscribersOrder.Count != 3 || subscribersOrder[0] != 0 || subscribersOrder[1] != 1 || subscribersOrder[2] != 2) {
+				Debug.Log(LogLevel.Error, nameof(TickSubscribersOrderTest) + " test failed!");
+
+				return;
+			}
+
+			Debug.Log(LogLevel.Display, "Tick subscribers are invoked in the order of priority");
+		}
+
 		private void ActorMemoryManagementTest() {
 			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
 
@@ -192,5 +216,18 @@ namespace UnrealEngine.Tests {
 
 			Debug.Log(LogLevel.Error, MethodBase.GetCurrentMethod().Name + " test failed!");
 		}
+
+		private void TickSubscribersOrderTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			subscriptions = new[] {
+				World.Subscribe(TickGroup.PrePhysics, deltaTime => subscribersOrder.Add(2), priority: 10),
+				World.Subscribe(TickGroup.PrePhysics, deltaTime => subscribersOrder.Add(0), priority: -10),
+				World.Subscribe(TickGroup.PrePhysics, deltaTime => subscribersOrder.Add(1)),
+				World.Subscribe(TickGroup.PrePhysics, deltaTime => subscribersOrder.Add(3), priority: 5)
+			};
+
+			subscriptions[3].Enabled = false;
+		}
 	}
 }
\ No newline at end of file
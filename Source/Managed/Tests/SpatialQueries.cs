@@ -1,5 +1,7 @@
 namespace UnrealEngine.Tests {
 	public class SpatialQueries : ISystem {
+		private TraceBatch traceBatch;
+
 		public void OnBeginPlay() {
 			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
 
@@ -86,6 +88,30 @@ namespace UnrealEngine.Tests {
 
 			if (overlapByProfile)
 				Debug.AddOnScreenMessage(-1, 15.0f, Color.MediumTurquoise, "Box overlap by profile!");
+
+			traceBatch = new(2);
+			traceBatch.Add(TraceQuery.CreateLine(lineTraceStart, boxLocation, CollisionChannel.WorldStatic));
+			traceBatch.Add(TraceQuery.CreateSweep(lineTraceStart, boxLocation, Quaternion.Identity, sphereShape, CollisionChannel.WorldStatic));
+
+			int batchBlockingHits = traceBatch.Execute();
+
+			Assert.IsTrue(batchBlockingHits == 2);
+			Assert.IsTrue(traceBatch.Results[0].BlockingHit);
+			Assert.IsTrue(traceBatch.Results[1].BlockingHit);
+
+			if (batchBlockingHits == 2)
+				Debug.AddOnScreenMessage(-1, 15.0f, Color.Orange, "Batched trace and sweep hit by channel!");
+
+			traceBatch.Submit();
+		}
+
+		public void OnTick(float deltaTime) {
+			if (traceBatch.IsPending && traceBatch.TryComplete()) {
+				Assert.IsTrue(traceBatch.BlockingHits == 2);
+
+				if (traceBatch.BlockingHits == 2)
+					Debug.AddOnScreenMessage(-1, 15.0f, Color.Orange, "Asynchronous batched trace and sweep hit by channel!");
+			}
 		}
 
 		public void OnEndPlay() => Debug.ClearOnScreenMessages();
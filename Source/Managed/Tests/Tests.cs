@@ -1,4 +1,5 @@
 global using System;
+global using System.Collections.Generic;
 global using System.Drawing;
 global using System.Numerics;
 global using System.Reflection;
@@ -7,10 +8,15 @@ global using UnrealEngine.Framework;
 namespace UnrealEngine.Tests {
 	public class Main {
 		private static ISystem runningSystem;
+		private const string performanceSuiteCommand = "Tests.PerformanceSuite";
 
 		public static void OnWorldPostBegin() {
 			Debug.Log(LogLevel.Display, "Hello, Unreal Engine!");
 
+			// The suite can be started unattended with -ExecCmds="Tests.PerformanceSuite" -Unattended
+
+			ConsoleManager.RegisterCommand(performanceSuiteCommand, "Runs the performance suite in the current world", RunPerformanceSuite);
+
 			if (World.CurrentLevelName == "Tests") {
 				TestSystems testSystem = default;
 
@@ -48,10 +54,19 @@ namespace UnrealEngine.Tests {
 
 		public static void OnWorldEnd() {
 			runningSystem?.OnEndPlay();
+			runningSystem = null;
+
+			ConsoleManager.UnregisterObject(performanceSuiteCommand);
 
 			Debug.Log(LogLevel.Display, "See you soon, Unreal Engine!");
 		}
 
+		private static void RunPerformanceSuite() {
+			runningSystem?.OnEndPlay();
+			runningSystem = new PerformanceSuite();
+			runningSystem.OnBeginPlay();
+		}
+
 		private enum TestSystems {
 			AssertionConsistency,
 			AudioPlayback,
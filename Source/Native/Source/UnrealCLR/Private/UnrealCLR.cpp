@@ -27,6 +27,44 @@
 
 DEFINE_LOG_CATEGORY(LogUnrealCLR);
 
+DECLARE_MEMORY_STAT(TEXT("Frame arena used"), STAT_FrameArenaUsed, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Frame arena high-water mark"), STAT_FrameArenaHighWaterMark, STATGROUP_UnrealCLR);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Frame arena overflows"), STAT_FrameArenaOverflows, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed heap size"), STAT_ManagedHeapSize, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed heap committed"), STAT_ManagedHeapCommitted, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed heap fragmented"), STAT_ManagedHeapFragmented, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated per frame"), STAT_ManagedFrameAllocated, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated in pre-physics tick"), STAT_ManagedPrePhysicsAllocated, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated in during physics tick"), STAT_ManagedDuringPhysicsAllocated, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated in post-physics tick"), STAT_ManagedPostPhysicsAllocated, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated in post update tick"), STAT_ManagedPostUpdateAllocated, STATGROUP_UnrealCLR);
+DECLARE_MEMORY_STAT(TEXT("Managed allocated in other events"), STAT_ManagedEventsAllocated, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GC pause time (ms)"), STAT_ManagedPauseDuration, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GC gen0 collections"), STAT_ManagedGen0Collections, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GC gen1 collections"), STAT_ManagedGen1Collections, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("GC gen2 collections"), STAT_ManagedGen2Collections, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timers expired"), STAT_TimersExpired, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timers scheduled"), STAT_TimersScheduled, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fixed substeps"), STAT_FixedSubsteps, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mutations drained"), STAT_MutationsDrained, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mutation queue depth"), STAT_MutationQueueDepth, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Mutation queue stalls"), STAT_MutationQueueStalls, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Mutation drain latency (ms)"), STAT_MutationDrainLatency, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debug draw records"), STAT_DebugDrawRecords, STATGROUP_UnrealCLR);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Debug draw overflows"), STAT_DebugDrawOverflows, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Fixed step time dropped (ms)"), STAT_FixedStepTimeDropped, STATGROUP_UnrealCLR);
+
+CSV_DEFINE_CATEGORY(UnrealCLR, true);
+
+static TAutoConsoleVariable<float> CVarGarbageCollectionFrameBudget(TEXT("clr.GC.FrameBudget"), 0.0f, TEXT("Frame time budget in milliseconds used to compute idle time for garbage collection after the post update tick, zero derives it from the maximum tick rate"), ECVF_Default);
+static TAutoConsoleVariable<int32> CVarFixedStepMaxSubsteps(TEXT("clr.FixedStep.MaxSubsteps"), 4, TEXT("Maximum number of fixed substeps executed in a frame when the tick group does not specify its own limit, the remaining time is dropped to let the simulation catch up"), ECVF_Default);
+static TAutoConsoleVariable<int32> CVarMutationQueueTickGroup(TEXT("clr.MutationQueue.TickGroup"), 0, TEXT("Tick group in which engine mutations queued from managed threads are executed: 0 - pre-physics, 1 - during physics, 2 - post-physics, 3 - post-update"), ECVF_Default);
+static TAutoConsoleVariable<int32> CVarMutationQueueCapacity(TEXT("clr.MutationQueue.Capacity"), 4096, TEXT("Number of engine mutations that can be queued from managed threads before producers are blocked, rounded up to a power of two and applied at startup"), ECVF_ReadOnly);
+static TAutoConsoleVariable<int32> CVarInputEventsCapacity(TEXT("clr.InputEvents.Capacity"), 1024, TEXT("Number of input events of managed bindings buffered per frame in each world before new events are dropped, applied when the world is initialized"), ECVF_Default);
+static TAutoConsoleVariable<int32> CVarDebugDrawBufferSize(TEXT("clr.DebugDraw.BufferSize"), 2 * 1024 * 1024, TEXT("Size in bytes of each of the two buffers used to batch debug drawing and on-screen messages from managed code, applied at startup, ignored in builds without debug drawing"), ECVF_ReadOnly);
+static TAutoConsoleVariable<int32> CVarAsyncBoot(TEXT("clr.AsyncBoot"), 1, TEXT("Boots the host on a background thread overlapped with the engine startup instead of the module loading path"), ECVF_ReadOnly);
+static TAutoConsoleVariable<int32> CVarFrameArenaSize(TEXT("clr.FrameArenaSize"), 4 * 1024 * 1024, TEXT("Size in bytes of the per-frame arena used for transient interop memory, applied at startup"), ECVF_ReadOnly);
+
 void UnrealCLR::Module::StartupModule() {
 	#define HOSTFXR_VERSION "8.0.8"
 	#define HOSTFXR_WINDOWS "hostfxr.dll"
@@ -47,12 +85,28 @@ void UnrealCLR::Module::StartupModule() {
 	#endif
 
 	UnrealCLR::Status = UnrealCLR::StatusType::Stopped;
+	UnrealCLR::FrameArena.Initialize(CVarFrameArenaSize.GetValueOnAnyThread());
+	UnrealCLR::Mutations.Initialize(CVarMutationQueueCapacity.GetValueOnAnyThread());
+	UnrealCLR::DebugDrawBuffers.Initialize(CVarDebugDrawBufferSize.GetValueOnAnyThread());
 	UnrealCLR::ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
 	UnrealCLR::UserAssembliesPath = UnrealCLR::ProjectPath + TEXT("Managed/");
 
 	OnWorldPostInitializationHandle = FWorldDelegates::OnPostWorldInitialization.AddRaw(this, &UnrealCLR::Module::OnWorldPostInitialization);
 	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &UnrealCLR::Module::OnWorldCleanup);
+	OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &UnrealCLR::Module::OnEndFrame);
+
+	CaptureCommand = IConsoleManager::Get().RegisterConsoleCommand(TEXT("clr.Capture"), TEXT("Records commands of the engine to the managed runtime and framework calls with their arguments, results, and timing from the next assemblies loading until they are unloaded to a file for offline replay: clr.Capture start [Path] | stop"), FConsoleCommandWithArgsDelegate::CreateRaw(this, &UnrealCLR::Module::Capture), ECVF_Default);
+	TraceCommand = IConsoleManager::Get().RegisterConsoleCommand(TEXT("clr.Trace"), TEXT("Starts or stops an in-process EventPipe session of the managed runtime that writes CPU samples, GC, and JIT events with frame markers to a nettrace file: clr.Trace start [Path] | stop"), FConsoleCommandWithArgsDelegate::CreateRaw(this, &UnrealCLR::Module::Trace), ECVF_Default);
+
+	// The host is booted in the background while the engine continues to start, the game thread waits for it only when the first game world arrives earlier
+
+	if (CVarAsyncBoot.GetValueOnAnyThread() != 0)
+		BootTask = Async(EAsyncExecution::Thread, [this]() { Boot(); });
+	else
+		Boot();
+}
 
+void UnrealCLR::Module::Boot() {
 	const FString hostfxrPath = UnrealCLR::ProjectPath + TEXT(HOSTFXR_PATH);
 	const FString assembliesPath = UnrealCLR::ProjectPath + TEXT("Plugins/UnrealCLR/Managed/");
 	const FString runtimeConfigPath = assembliesPath + TEXT("UnrealEngine.Runtime.runtimeconfig.json");
@@ -62,6 +116,9 @@ void UnrealCLR::Module::StartupModule() {
 
 	UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host path set to \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), *hostfxrPath);
 
+	const double bootTime = FPlatformTime::Seconds();
+	double phaseTime = bootTime;
+
 	HostfxrLibrary = FPlatformProcess::GetDllHandle(*hostfxrPath);
 
 	if (HostfxrLibrary) {
@@ -101,6 +158,8 @@ void UnrealCLR::Module::StartupModule() {
 
 		HostfxrSetErrorWriter(&HostError);
 
+		phaseTime = LogBootPhase(TEXT("Host library"), phaseTime);
+
 		hostfxr_handle HostfxrContext = nullptr;
 
 		if (HostfxrInitializeForRuntimeConfig(UNREALCLR_PLATFORM_STRING(*runtimeConfigPath), nullptr, &HostfxrContext) != 0 || !HostfxrContext) {
@@ -125,10 +184,14 @@ void UnrealCLR::Module::StartupModule() {
 
 		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host functions loaded successfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
 
+		phaseTime = LogBootPhase(TEXT("Runtime initialization"), phaseTime);
+
 		load_assembly_and_get_function_pointer_fn HostfxrLoadAssemblyAndGetFunctionPointer = (load_assembly_and_get_function_pointer_fn)hostfxrLoadAssemblyAndGetFunctionPointer;
 
 		if (HostfxrLoadAssemblyAndGetFunctionPointer && HostfxrLoadAssemblyAndGetFunctionPointer(UNREALCLR_PLATFORM_STRING(*runtimeAssemblyPath), UNREALCLR_PLATFORM_STRING(*runtimeTypeName), UNREALCLR_PLATFORM_STRING(*runtimeMethodName), UNMANAGEDCALLERSONLY_METHOD, nullptr, (void**)&UnrealCLR::ManagedCommand) == 0) {
 			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host runtime assembly loaded successfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+
+			phaseTime = LogBootPhase(TEXT("Runtime assembly"), phaseTime);
 		} else {
 			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly loading failed!"), ANSI_TO_TCHAR(__FUNCTION__));
 
@@ -156,7 +219,7 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::AssertFunctions;
 
-				Shared::AssertFunctions[head++] = (void*)&UnrealCLRFramework::Assert::OutputMessage;
+				Shared::AssertFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Assert::OutputMessage);
 
 				checksum += head;
 			}
@@ -165,9 +228,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::CommandLineFunctions;
 
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Get;
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Set;
-				Shared::CommandLineFunctions[head++] = (void*)&UnrealCLRFramework::CommandLine::Append;
+				Shared::CommandLineFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::CommandLine::Set);
+				Shared::CommandLineFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::CommandLine::Append);
 
 				checksum += head;
 			}
@@ -176,10 +238,8 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::DebugFunctions;
 
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::Log;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::Exception;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::AddOnScreenMessage;
-				Shared::DebugFunctions[head++] = (void*)&UnrealCLRFramework::Debug::ClearOnScreenMessages;
+				Shared::DebugFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Debug::Log);
+				Shared::DebugFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Debug::Exception);
 
 				checksum += head;
 			}
@@ -188,31 +248,162 @@ void UnrealCLR::Module::StartupModule() {
 				int32 head = 0;
 				Shared::Functions[position++] = Shared::ApplicationFunctions;
 
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsCanEverRender;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsPackagedForDistribution;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::IsPackagedForShipping;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetProjectDirectory;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetDefaultLanguage;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetProjectName;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::GetVolumeMultiplier;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::SetProjectName;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::SetVolumeMultiplier;
-				Shared::ApplicationFunctions[head++] = (void*)&UnrealCLRFramework::Application::RequestExit;
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::GetEnvironment);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::GetInteropCalls);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::GetVolumeMultiplier);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::SetProjectName);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::SetVolumeMultiplier);
+				Shared::ApplicationFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Application::RequestExit);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::WorldFunctions;
+
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::TraceBatch);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::SubmitTraceBatch);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::QueryTraceBatch);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::Subscribe);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::Unsubscribe);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::GetSubscriberStates);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::SetFixedStep);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::GetInterpolationAlpha);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::FindActor);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::FindActorByTag);
+				Shared::WorldFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::World::FindActorByID);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::TickFunctionFunctions;
+
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::Create);
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::Destroy);
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::SetEnabled);
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::SetInterval);
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::AddPrerequisite);
+				Shared::TickFunctionFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TickFunction::AddTickFunctionPrerequisite);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::TimerFunctions;
+
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::SetHandler);
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::Schedule);
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::Cancel);
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::IsScheduled);
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::GetRemaining);
+				Shared::TimerFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Timer::GetCount);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::FunctionHandleFunctions;
+
+				Shared::FunctionHandleFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::FunctionHandle::Resolve);
+				Shared::FunctionHandleFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::FunctionHandle::GetParameters);
+				Shared::FunctionHandleFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::FunctionHandle::GetParameterOffset);
+				Shared::FunctionHandleFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::FunctionHandle::Invoke);
+				Shared::FunctionHandleFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::FunctionHandle::Release);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::ActorQueryFunctions;
+
+				Shared::ActorQueryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::ActorQuery::Create);
+				Shared::ActorQueryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::ActorQuery::Update);
+				Shared::ActorQueryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::ActorQuery::Release);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::SplineFunctions;
+
+				Shared::SplineFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Spline::Sample);
+				Shared::SplineFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Spline::SetPoints);
+				Shared::SplineFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Spline::UpdatePoints);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::AnimationBindingFunctions;
+
+				Shared::AnimationBindingFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::AnimationBinding::Create);
+				Shared::AnimationBindingFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::AnimationBinding::Read);
+				Shared::AnimationBindingFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::AnimationBinding::Write);
+				Shared::AnimationBindingFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::AnimationBinding::Release);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::InputFunctions;
+
+				Shared::InputFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Input::SetHandler);
+				Shared::InputFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Input::SetTickGroup);
+				Shared::InputFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Input::BindAction);
+				Shared::InputFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Input::BindAxis);
+				Shared::InputFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Input::Unbind);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::TexturePixelsFunctions;
+
+				Shared::TexturePixelsFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TexturePixels::SetHandler);
+				Shared::TexturePixelsFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TexturePixels::Lock);
+				Shared::TexturePixelsFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TexturePixels::Unlock);
+				Shared::TexturePixelsFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::TexturePixels::UpdateRegions);
+
+				checksum += head;
+			}
+
+			{
+				int32 head = 0;
+				Shared::Functions[position++] = Shared::MemoryFunctions;
+
+				Shared::MemoryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Memory::GetFrameArena);
+				Shared::MemoryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Memory::GetMutationQueue);
+				Shared::MemoryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Memory::SetMutationHandler);
+				Shared::MemoryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Memory::GetDebugDraw);
+				Shared::MemoryFunctions[head++] = UNREALCLR_BIND(UnrealCLRFramework::Memory::IsInGameThread);
 
 				checksum += head;
 			}
 
 			checksum += position;
 
+			UnrealCLR::Capture::Checksum = checksum;
+
 			// Runtime pointers
 
-			Shared::RuntimeFunctions[0] = (void*)&UnrealCLR::Module::Exception;
-			Shared::RuntimeFunctions[1] = (void*)&UnrealCLR::Module::Log;
+			Shared::RuntimeFunctions[0] = UNREALCLR_BIND(UnrealCLR::Module::Exception);
+			Shared::RuntimeFunctions[1] = UNREALCLR_BIND(UnrealCLR::Module::Log);
+			Shared::RuntimeFunctions[2] = UNREALCLR_BIND(UnrealCLR::Module::RegisterEvent);
 
 			constexpr void* functions[3] = {
 				Shared::RuntimeFunctions,
-				Shared::Events,
-				Shared::Functions
+				Shared::Functions,
+				&UnrealCLR::ManagedTelemetry
 			};
 
 			if (reinterpret_cast<intptr_t>(UnrealCLR::ManagedCommand(UnrealCLR::Command(functions, checksum))) == 0xF) {
@@ -223,9 +414,11 @@ void UnrealCLR::Module::StartupModule() {
 				return;
 			}
 
+			LogBootPhase(TEXT("Framework initialization"), phaseTime);
+
 			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
 
-			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host loaded successfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host loaded successfuly in %.2f ms!"), ANSI_TO_TCHAR(__FUNCTION__), (FPlatformTime::Seconds() - bootTime) * 1000.0);
 		} else {
 			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly unable to load the initialization function!"), ANSI_TO_TCHAR(__FUNCTION__));
 
@@ -236,75 +429,208 @@ void UnrealCLR::Module::StartupModule() {
 	}
 }
 
+double UnrealCLR::Module::LogBootPhase(const TCHAR* Phase, double StartTime) {
+	const double time = FPlatformTime::Seconds();
+
+	UE_LOG(LogUnrealCLR, Display, TEXT("%s: %s phase took %.2f ms"), ANSI_TO_TCHAR(__FUNCTION__), Phase, (time - StartTime) * 1000.0);
+
+	return time;
+}
+
+void UnrealCLR::Module::WaitForBoot() {
+	if (!BootTask.IsValid() || BootTask.IsReady())
+		return;
+
+	const double waitTime = FPlatformTime::Seconds();
+
+	BootTask.Wait();
+
+	UE_LOG(LogUnrealCLR, Display, TEXT("%s: Game thread waited %.2f ms for the host to boot"), ANSI_TO_TCHAR(__FUNCTION__), (FPlatformTime::Seconds() - waitTime) * 1000.0);
+}
+
 void UnrealCLR::Module::ShutdownModule() {
+	WaitForBoot();
+
 	FWorldDelegates::OnPostWorldInitialization.Remove(OnWorldPostInitializationHandle);
 	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+	FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+
+	IConsoleManager::Get().UnregisterConsoleObject(CaptureCommand);
+	IConsoleManager::Get().UnregisterConsoleObject(TraceCommand);
+
+	if (UnrealCLR::Capture::Writer)
+		UnrealCLR::Capture::Stop();
+
+	if (UnrealCLR::Tracing) {
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::Trace, nullptr));
+		UnrealCLR::Tracing = false;
+	}
 
 	FPlatformProcess::FreeDllHandle(HostfxrLibrary);
+
+	UnrealCLR::FrameArena.Release();
+	UnrealCLR::Mutations.Release();
+	UnrealCLR::DebugDrawBuffers.Release();
 }
 
 void UnrealCLR::Module::OnWorldPostInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues) {
-	if (World->IsGameWorld()) {
-		if (UnrealCLR::WorldTickState == TickState::Stopped) {
-			UnrealCLR::Engine::Manager = NewObject<UUnrealCLRManager>();
-			UnrealCLR::Engine::Manager->AddToRoot();
-			UnrealCLR::Engine::World = World;
+	if (World->IsGameWorld() && !UnrealCLR::WorldContexts.ContainsByPredicate([World](const TUniquePtr<WorldContext>& Context) { return Context->World == World; })) {
+		WaitForBoot();
 
-			if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
+		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
+			if (UnrealCLR::WorldContexts.Num() == 0) {
 				UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::LoadAssemblies));
 				UnrealCLR::Status = UnrealCLR::StatusType::Running;
+			}
 
-				for (TActorIterator<AWorldSettings> currentActor(UnrealCLR::Engine::World); currentActor; ++currentActor) {
-					RegisterTickFunction(OnPrePhysicsTickFunction, TG_PrePhysics, *currentActor);
-					RegisterTickFunction(OnDuringPhysicsTickFunction, TG_DuringPhysics, *currentActor);
-					RegisterTickFunction(OnPostPhysicsTickFunction, TG_PostPhysics, *currentActor);
-					RegisterTickFunction(OnPostUpdateTickFunction, TG_PostUpdateWork, *currentActor);
+			WorldContext* context = UnrealCLR::WorldContexts.Add_GetRef(MakeUnique<WorldContext>()).Get();
+
+			context->Id = ++UnrealCLR::LastWorldContextId;
+			context->World = World;
+			context->Manager = NewObject<UUnrealCLRManager>();
+			context->Manager->AddToRoot();
+			context->WorldTickState = UnrealCLR::TickState::Stopped;
+			context->DispatchingEvent = INDEX_NONE;
+			context->PendingRemoval = false;
+			context->PendingSystemTickFunctions = 0;
+			context->StaggeredSystemTickFunctions = 0;
+			context->Timers.Initialize(World->GetTimeSeconds());
+			context->InputBindingsHandle = 0;
+			context->InputEventsCapacity = FMath::Max(CVarInputEventsCapacity.GetValueOnGameThread(), 1);
+			context->InputEventsDropped = 0;
+			context->InputTickGroup = OnWorldPrePhysicsTick;
+			context->InputEvents.Reserve(context->InputEventsCapacity);
+
+			FMemory::Memzero(context->FixedSteps);
+
+			context->OnPrePhysicsTickFunction.Context = context;
+			context->OnDuringPhysicsTickFunction.Context = context;
+			context->OnPostPhysicsTickFunction.Context = context;
+			context->OnPostUpdateTickFunction.Context = context;
+
+			for (int32 event = 0; event < Shared::storageSize; event++) {
+				context->Events[event] = UnrealCLR::Shared::Events[event];
+			}
 
-					UnrealCLR::WorldTickState = UnrealCLR::TickState::Registered;
+			context->Enter();
 
-					if (UnrealCLR::Shared::Events[OnWorldBegin])
-						UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldBegin]));
+			for (TActorIterator<AWorldSettings> currentActor(World); currentActor; ++currentActor) {
+				RegisterTickFunction(context->OnPrePhysicsTickFunction, TG_PrePhysics, World, context->Manager, *currentActor);
+				RegisterTickFunction(context->OnDuringPhysicsTickFunction, TG_DuringPhysics, World, context->Manager, *currentActor);
+				RegisterTickFunction(context->OnPostPhysicsTickFunction, TG_PostPhysics, World, context->Manager, *currentActor);
+				RegisterTickFunction(context->OnPostUpdateTickFunction, TG_PostUpdateWork, World, context->Manager, *currentActor);
 
-					break;
-				}
-			} else {
-				#if WITH_EDITOR
-					FNotificationInfo notificationInfo(FText::FromString(TEXT("UnrealCLR host is not initialized! Please, check logs and try to restart the engine.")));
+				context->WorldTickState = UnrealCLR::TickState::Registered;
 
-					notificationInfo.ExpireDuration = 5.0f;
+				context->Invoke(OnWorldBegin);
 
-					FSlateNotificationManager::Get().AddNotification(notificationInfo);
-				#endif
+				break;
 			}
+
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: World \"%s\" attached, %d world contexts are active"), ANSI_TO_TCHAR(__FUNCTION__), *World->GetName(), UnrealCLR::WorldContexts.Num());
+		} else {
+			#if WITH_EDITOR
+				FNotificationInfo notificationInfo(FText::FromString(TEXT("UnrealCLR host is not initialized! Please, check logs and try to restart the engine.")));
+
+				notificationInfo.ExpireDuration = 5.0f;
+
+				FSlateNotificationManager::Get().AddNotification(notificationInfo);
+			#endif
 		}
 	}
 }
 
 void UnrealCLR::Module::OnWorldCleanup(UWorld* World, bool SessionEnded, bool CleanupResources) {
-	if (World->IsGameWorld() && World == UnrealCLR::Engine::World && UnrealCLR::WorldTickState != UnrealCLR::TickState::Stopped) {
+	const int32 index = UnrealCLR::WorldContexts.IndexOfByPredicate([World](const TUniquePtr<WorldContext>& Context) { return Context->World == World; });
+
+	if (World->IsGameWorld() && index != INDEX_NONE) {
+		WorldContext* context = UnrealCLR::WorldContexts[index].Get();
+
 		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
-			if (UnrealCLR::Shared::Events[OnWorldEnd])
-				UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldEnd]));
+			context->Enter();
+
+			context->Invoke(OnWorldEnd);
+
+			context->OnPrePhysicsTickFunction.UnRegisterTickFunction();
+			context->OnDuringPhysicsTickFunction.UnRegisterTickFunction();
+			context->OnPostPhysicsTickFunction.UnRegisterTickFunction();
+			context->OnPostUpdateTickFunction.UnRegisterTickFunction();
+
+			for (const TPair<int32, TUniquePtr<SystemTickFunction>>& tickFunction : context->SystemTickFunctions) {
+				tickFunction.Value->UnRegisterTickFunction();
+			}
+		}
 
-			OnPrePhysicsTickFunction.UnRegisterTickFunction();
-			OnDuringPhysicsTickFunction.UnRegisterTickFunction();
-			OnPostPhysicsTickFunction.UnRegisterTickFunction();
-			OnPostUpdateTickFunction.UnRegisterTickFunction();
+		UnrealCLRFramework::World::ReleaseTraceBatches(World);
+		UnrealCLRFramework::World::ReleaseActorIndex(World);
+		UnrealCLRFramework::ActorQuery::ReleaseAll(World);
+		UnrealCLR::ReleaseSubscribers(context);
 
+		context->Timers.Release();
+		context->ReleaseInput();
+		context->Manager->RemoveFromRoot();
+
+		UnrealCLR::WorldContexts.RemoveAt(index);
+
+		if (UnrealCLR::WorldContexts.Num() > 0) {
+			UnrealCLR::WorldContexts[0]->Enter();
+
+			return;
+		}
+
+		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
+			UnrealCLR::TextureUploadQueue.Dispatch(true);
 			UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::UnloadAssemblies));
 			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
 		}
 
+		UnrealCLR::Shared::TimerHandler = nullptr;
+		UnrealCLR::Shared::MutationHandler = nullptr;
+		UnrealCLR::Shared::InputHandler = nullptr;
+		UnrealCLR::Shared::TextureUploadHandler = nullptr;
+		UnrealCLR::Mutations.Consume(UnrealCLR::Mutations.Peek());
+		UnrealCLR::DebugDrawBuffers.Reset();
+		UnrealCLRFramework::FunctionHandle::ReleaseAll();
+		UnrealCLRFramework::AnimationBinding::ReleaseAll();
+
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Frame arena high-water mark is %lld of %lld bytes"), ANSI_TO_TCHAR(__FUNCTION__), UnrealCLR::FrameArena.HighWaterMark, UnrealCLR::FrameArena.Capacity);
+
 		UnrealCLR::Engine::World = nullptr;
-		UnrealCLR::Engine::Manager->RemoveFromRoot();
 		UnrealCLR::Engine::Manager = nullptr;
-		UnrealCLR::WorldTickState = UnrealCLR::TickState::Stopped;
+		UnrealCLR::Engine::Context = nullptr;
+
+		for (TArray<Subscriber>& event : UnrealCLR::Shared::Events) {
+			event.Reset();
+		}
+
+		FMemory::Memzero(UnrealCLR::Shared::SubscriberStates);
+		FMemory::Memzero(UnrealCLR::Shared::SubscriberEvents);
+	}
+}
+
+void UnrealCLR::Module::OnEndFrame() {
+	if (UnrealCLR::WorldContexts.Num() == 0)
+		return;
+
+	UnrealCLR::FrameArena.Reset();
+	UnrealCLR::TextureUploadQueue.Dispatch(false);
+	UnrealCLRFramework::World::ExpireTraceBatches();
 
-		FMemory::Memset(UnrealCLR::Shared::Events, 0, sizeof(UnrealCLR::Shared::Events));
+	float frameBudget = CVarGarbageCollectionFrameBudget.GetValueOnGameThread();
+
+	if (frameBudget <= 0.0f) {
+		const float maxTickRate = GEngine->GetMaxTickRate(FApp::GetDeltaTime(), false);
+
+		frameBudget = 1000.0f / (maxTickRate > 0.0f ? maxTickRate : 60.0f);
 	}
+
+	const float frameTime = (float)((FPlatformTime::Seconds() - FApp::GetCurrentTime()) * 1000.0);
+
+	UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::CommandType::Idle, frameBudget - frameTime));
+	UnrealCLR::ManagedTelemetry.Publish();
 }
 
-void UnrealCLR::Module::RegisterTickFunction(FTickFunction& TickFunction, ETickingGroup TickGroup, AWorldSettings* LevelActor) {
+void UnrealCLR::Module::RegisterTickFunction(FTickFunction& TickFunction, ETickingGroup TickGroup, UWorld* World, UUnrealCLRManager* Manager, AWorldSettings* LevelActor) {
 	TickFunction.bCanEverTick = true;
 	TickFunction.bTickEvenWhenPaused = false;
 	TickFunction.bStartWithTickEnabled = true;
@@ -312,8 +638,8 @@ void UnrealCLR::Module::RegisterTickFunction(FTickFunction& TickFunction, ETicki
 	TickFunction.bAllowTickOnDedicatedServer = true;
 	TickFunction.bRunOnAnyThread = false;
 	TickFunction.TickGroup = TickGroup;
-	TickFunction.RegisterTickFunction(UnrealCLR::Engine::World->PersistentLevel);
-	LevelActor->PrimaryActorTick.AddPrerequisite(UnrealCLR::Engine::Manager, TickFunction);
+	TickFunction.RegisterTickFunction(World->PersistentLevel);
+	LevelActor->PrimaryActorTick.AddPrerequisite(Manager, TickFunction);
 }
 
 void UnrealCLR::Module::HostError(const char_t* Message) {
@@ -331,7 +657,10 @@ void UnrealCLR::Module::Exception(const char* Message) {
 
 	UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *OutputLog);
 
-	GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *message);
+	// Managed initialization runs on the boot thread, on-screen messages are added only from the game thread
+
+	if (IsInGameThread() && GEngine)
+		GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *message);
 }
 
 void UnrealCLR::Module::Log(UnrealCLR::LogLevel Level, const char* Message) {
@@ -339,64 +668,1302 @@ void UnrealCLR::Module::Log(UnrealCLR::LogLevel Level, const char* Message) {
 
 	FString message(ANSI_TO_TCHAR(Message));
 
+	const bool onScreen = IsInGameThread() && GEngine;
+
 	if (Level == UnrealCLR::LogLevel::Display) {
 		UNREALCLR_LOG(Display);
 	} else if (Level == UnrealCLR::LogLevel::Warning) {
 		UNREALCLR_LOG(Warning);
 
-		GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Yellow, *message);
+		if (onScreen)
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Yellow, *message);
 	} else if (Level == UnrealCLR::LogLevel::Error) {
 		UNREALCLR_LOG(Error);
 
-		GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
+		if (onScreen)
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
 	} else if (Level == UnrealCLR::LogLevel::Fatal) {
 		UNREALCLR_LOG(Error);
 
-		GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
+		if (onScreen)
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *message);
 
 		UnrealCLR::Status = UnrealCLR::StatusType::Idle;
 	}
 }
 
+void UnrealCLR::Module::Trace(const TArray<FString>& Arguments) {
+	WaitForBoot();
+
+	if (UnrealCLR::Status == UnrealCLR::StatusType::Stopped) {
+		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host is not initialized"), ANSI_TO_TCHAR(__FUNCTION__));
+
+		return;
+	}
+
+	if (Arguments.Num() > 0 && Arguments[0] == TEXT("start")) {
+		if (UnrealCLR::Tracing) {
+			UE_LOG(LogUnrealCLR, Warning, TEXT("%s: Trace session is already started"), ANSI_TO_TCHAR(__FUNCTION__));
+
+			return;
+		}
+
+		const FString path = Arguments.Num() > 1 ? FPaths::ConvertRelativePathToFull(Arguments[1]) : FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir() / TEXT("UnrealCLR-") + FDateTime::Now().ToString() + TEXT(".nettrace"));
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(path), true);
+
+		UnrealCLR::Tracing = reinterpret_cast<intptr_t>(UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::Trace, (void*)TCHAR_TO_UTF8(*path)))) != 0;
+		UnrealCLR::TracedFrame = 0;
+
+		if (UnrealCLR::Tracing)
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Trace session started, writing to \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), *path);
+	} else if (Arguments.Num() > 0 && Arguments[0] == TEXT("stop")) {
+		if (!UnrealCLR::Tracing) {
+			UE_LOG(LogUnrealCLR, Warning, TEXT("%s: Trace session is not started"), ANSI_TO_TCHAR(__FUNCTION__));
+
+			return;
+		}
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::Trace, nullptr));
+		UnrealCLR::Tracing = false;
+
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Trace session stopped"), ANSI_TO_TCHAR(__FUNCTION__));
+	} else {
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Usage: clr.Trace start [Path] | stop"), ANSI_TO_TCHAR(__FUNCTION__));
+	}
+}
+
+void UnrealCLR::Module::Capture(const TArray<FString>& Arguments) {
+	#if UNREALCLR_CAPTURE
+		WaitForBoot();
+
+		if (UnrealCLR::Status == UnrealCLR::StatusType::Stopped) {
+			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host is not initialized"), ANSI_TO_TCHAR(__FUNCTION__));
+
+			return;
+		}
+
+		if (Arguments.Num() > 0 && Arguments[0] == TEXT("start")) {
+			if (UnrealCLR::Capture::Writer) {
+				UE_LOG(LogUnrealCLR, Warning, TEXT("%s: Capture is already started"), ANSI_TO_TCHAR(__FUNCTION__));
+
+				return;
+			}
+
+			const FString path = Arguments.Num() > 1 ? FPaths::ConvertRelativePathToFull(Arguments[1]) : FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir() / TEXT("UnrealCLR-") + FDateTime::Now().ToString() + TEXT(".clrcapture"));
+
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(path), true);
+
+			if (UnrealCLR::Capture::Start(path))
+				UE_LOG(LogUnrealCLR, Display, TEXT("%s: Capture started, recording from the next assemblies loading to \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), *path);
+			else
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to create a capture file at \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), *path);
+		} else if (Arguments.Num() > 0 && Arguments[0] == TEXT("stop")) {
+			if (!UnrealCLR::Capture::Writer) {
+				UE_LOG(LogUnrealCLR, Warning, TEXT("%s: Capture is not started"), ANSI_TO_TCHAR(__FUNCTION__));
+
+				return;
+			}
+
+			UnrealCLR::Capture::Stop();
+
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Capture stopped"), ANSI_TO_TCHAR(__FUNCTION__));
+		} else {
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Usage: clr.Capture start [Path] | stop"), ANSI_TO_TCHAR(__FUNCTION__));
+		}
+	#else
+		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Capture is not available in this build configuration"), ANSI_TO_TCHAR(__FUNCTION__));
+	#endif
+}
+
+void UnrealCLR::Module::RegisterEvent(int32 Event, void* Function) {
+	UnrealCLR::Subscribe(Event, Function, 0);
+}
+
+static FORCEINLINE void InsertSubscriber(TArray<UnrealCLR::Subscriber>& Subscribers, const UnrealCLR::Subscriber& Subscriber) {
+	Subscribers.Insert(Subscriber, Algo::UpperBoundBy(Subscribers, Subscriber.Priority, &UnrealCLR::Subscriber::Priority));
+}
+
+int32 UnrealCLR::Subscribe(int32 Event, void* Function, int32 Priority) {
+	if (Event < 0 || Event >= Shared::storageSize || !Function)
+		return INDEX_NONE;
+
+	int32 id = INDEX_NONE;
+
+	for (int32 i = 0; i < Shared::subscribersSize; i++) {
+		if (!Shared::SubscriberEvents[i]) {
+			id = i;
+
+			break;
+		}
+	}
+
+	if (id == INDEX_NONE) {
+		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Maximum number of %d event subscribers is reached"), ANSI_TO_TCHAR(__FUNCTION__), Shared::subscribersSize);
+
+		return INDEX_NONE;
+	}
+
+	const Subscriber subscriber = { Function, Priority, id };
+
+	Shared::SubscriberEvents[id] = Event + 1;
+	Shared::SubscriberStates[id] = 1;
+
+	WorldContext* context = Engine::Context;
+
+	if (!context)
+		InsertSubscriber(Shared::Events[Event], subscriber);
+	else if (context->DispatchingEvent == Event)
+		context->PendingSubscribers.Add(subscriber);
+	else
+		InsertSubscriber(context->Events[Event], subscriber);
+
+	return id;
+}
+
+void UnrealCLR::Unsubscribe(int32 Id) {
+	if (Id < 0 || Id >= Shared::subscribersSize || !Shared::SubscriberEvents[Id])
+		return;
+
+	const int32 event = Shared::SubscriberEvents[Id] - 1;
+	const auto isSubscriber = [Id](const Subscriber& Value) { return Value.Id == Id; };
+
+	Shared::SubscriberEvents[Id] = 0;
+	Shared::SubscriberStates[Id] = 0;
+	Shared::Events[event].RemoveAll(isSubscriber);
+
+	for (const TUniquePtr<WorldContext>& context : WorldContexts) {
+		context->PendingSubscribers.RemoveAll(isSubscriber);
+
+		if (context->DispatchingEvent == event) {
+			for (Subscriber& subscriber : context->Events[event]) {
+				if (subscriber.Id == Id)
+					subscriber.Function = nullptr;
+			}
+
+			context->PendingRemoval = true;
+		} else {
+			context->Events[event].RemoveAll(isSubscriber);
+		}
+	}
+}
+
+UnrealCLR::WorldContext* UnrealCLR::FindWorldContext(int32 Id) {
+	for (const TUniquePtr<WorldContext>& context : WorldContexts) {
+		if (context->Id == Id)
+			return context.Get();
+	}
+
+	return nullptr;
+}
+
+void UnrealCLR::ReleaseSubscribers(WorldContext* Context) {
+	for (int32 event = 0; event < Shared::storageSize; event++) {
+		for (const Subscriber& subscriber : Context->Events[event]) {
+			if (!Shared::Events[event].ContainsByPredicate([&subscriber](const Subscriber& Value) { return Value.Id == subscriber.Id; })) {
+				Shared::SubscriberEvents[subscriber.Id] = 0;
+				Shared::SubscriberStates[subscriber.Id] = 0;
+			}
+		}
+	}
+
+	for (const Subscriber& subscriber : Context->PendingSubscribers) {
+		Shared::SubscriberEvents[subscriber.Id] = 0;
+		Shared::SubscriberStates[subscriber.Id] = 0;
+	}
+}
+
 void UnrealCLR::PrePhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
-	if (UnrealCLR::WorldTickState != UnrealCLR::TickState::Started && UnrealCLR::Shared::Events[OnWorldPostBegin]) {
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostBegin]));
-		UnrealCLR::WorldTickState = UnrealCLR::TickState::Started;
+	Context->Enter();
+
+	if (Context->WorldTickState != UnrealCLR::TickState::Started) {
+		Context->Invoke(OnWorldPostBegin);
+		Context->WorldTickState = UnrealCLR::TickState::Started;
+	}
+
+	if (UnrealCLR::Tracing && UnrealCLR::TracedFrame != GFrameCounter) {
+		UnrealCLR::TracedFrame = GFrameCounter;
+
+		TRACE_BOOKMARK(TEXT("UnrealCLR frame %u"), (uint32)GFrameCounter);
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(CommandType::Frame, (uint32)GFrameCounter));
 	}
 
-	if (UnrealCLR::Shared::Events[OnWorldPrePhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPrePhysicsTick], DeltaTime));
+	if (Context->PendingSystemTickFunctions > 0)
+		Context->StartSystemTickFunctions();
+
+	if (Context->InputBindings.Num() > 0)
+		Context->UpdateInputTargets();
+
+	Context->DispatchTimers();
+	Context->DispatchInput(OnWorldPrePhysicsTick);
+	Context->DrainMutations(OnWorldPrePhysicsTick);
+	Context->Step(OnWorldPrePhysicsTick, DeltaTime);
+	Context->Invoke(OnWorldPrePhysicsTick, DeltaTime);
 }
 
 void UnrealCLR::DuringPhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
-	if (UnrealCLR::Shared::Events[OnWorldDuringPhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldDuringPhysicsTick], DeltaTime));
+	Context->Enter();
+
+	Context->DispatchInput(OnWorldDuringPhysicsTick);
+	Context->DrainMutations(OnWorldDuringPhysicsTick);
+	Context->Step(OnWorldDuringPhysicsTick, DeltaTime);
+	Context->Invoke(OnWorldDuringPhysicsTick, DeltaTime);
 }
 
 void UnrealCLR::PostPhysicsTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
-	if (UnrealCLR::Shared::Events[OnWorldPostPhysicsTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostPhysicsTick], DeltaTime));
+	Context->Enter();
+
+	Context->DispatchInput(OnWorldPostPhysicsTick);
+	Context->DrainMutations(OnWorldPostPhysicsTick);
+	Context->Step(OnWorldPostPhysicsTick, DeltaTime);
+	Context->Invoke(OnWorldPostPhysicsTick, DeltaTime);
 }
 
 void UnrealCLR::PostUpdateTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
-	if (UnrealCLR::Shared::Events[OnWorldPostUpdateTick])
-		UnrealCLR::ManagedCommand(UnrealCLR::Command(UnrealCLR::Shared::Events[OnWorldPostUpdateTick], DeltaTime));
+	Context->Enter();
+
+	Context->DispatchInput(OnWorldPostUpdateTick);
+	Context->DrainMutations(OnWorldPostUpdateTick);
+	Context->Step(OnWorldPostUpdateTick, DeltaTime);
+	Context->Invoke(OnWorldPostUpdateTick, DeltaTime);
+
+	UnrealCLR::DebugDrawBuffers.Submit(Context->World, Context->Id);
 }
 
-FString UnrealCLR::PrePhysicsTickFunction::DiagnosticMessage() {
-	return TEXT("PrePhysicsTickFunction");
+void UnrealCLR::SystemTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+	Context->Enter();
+
+	UnrealCLR::ManagedCommand(UnrealCLR::Command(Function, DeltaTime));
+	UnrealCLR::ManagedTelemetry.Attribute(Event);
 }
 
-FString UnrealCLR::DuringPhysicsTickFunction::DiagnosticMessage() {
-	return TEXT("DuringPhysicsTickFunction");
+void UnrealCLR::WorldContext::StartSystemTickFunctions() {
+	const double time = World->GetTimeSeconds();
+
+	for (const TPair<int32, TUniquePtr<SystemTickFunction>>& tickFunction : SystemTickFunctions) {
+		if (tickFunction.Value->PendingStart && time >= tickFunction.Value->StartTime) {
+			tickFunction.Value->PendingStart = false;
+			tickFunction.Value->SetTickFunctionEnable(true);
+
+			PendingSystemTickFunctions--;
+		}
+	}
 }
 
-FString UnrealCLR::PostPhysicsTickFunction::DiagnosticMessage() {
-	return TEXT("PostPhysicsTickFunction");
+void UnrealCLR::WorldContext::DispatchTimers() {
+	Timers.Advance(World->GetTimeSeconds());
+
+	INC_DWORD_STAT_BY(STAT_TimersExpired, Timers.Expired.Num());
+	INC_DWORD_STAT_BY(STAT_TimersScheduled, Timers.Count);
+
+	if (Timers.Expired.Num() > 0 && Shared::TimerHandler) {
+		ExpiredTimers.Ids = Timers.Expired.GetData();
+		ExpiredTimers.Count = Timers.Expired.Num();
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(Shared::TimerHandler, &ExpiredTimers));
+		UnrealCLR::ManagedTelemetry.Attribute(OnWorldPrePhysicsTick);
+	}
+
+	Timers.Expired.Reset();
 }
 
-FString UnrealCLR::PostUpdateTickFunction::DiagnosticMessage() {
-	return TEXT("PostUpdateTickFunction");
+void UnrealCLR::WorldContext::AddInputBinding(const InputTarget& Target, const InputBinding& Binding) {
+	UInputComponent* inputComponent = Target.Component.Get();
+
+	if (!inputComponent)
+		return;
+
+	const int32 id = Binding.Id;
+	const int32 player = Target.Player;
+
+	// Bindings don't consume input to leave it to other input components of the controller, events are recorded to the buffer instead of being delivered one by one
+
+	auto record = [this, id, player](UnrealCLRFramework::InputEventType Type, float Value) {
+		if (InputEvents.Num() >= InputEventsCapacity) {
+			InputEventsDropped++;
+
+			return;
+		}
+
+		InputEvents.Add({ id, Type, Value, player, FPlatformTime::Seconds() });
+	};
+
+	if (Binding.Axis) {
+		FInputAxisBinding axisBinding(Binding.Name);
+
+		axisBinding.bConsumeInput = false;
+
+		// Axes are evaluated every frame, only non-zero values and the return to zero are recorded
+
+		axisBinding.AxisDelegate.GetDelegateForManualSet().BindLambda([record, previous = 0.0f](float Value) mutable {
+			if (Value != 0.0f || previous != 0.0f)
+				record(UnrealCLRFramework::InputEventType::Axis, Value);
+
+			previous = Value;
+		});
+
+		inputComponent->AxisBindings.Add(axisBinding);
+	} else {
+		FInputActionBinding pressedBinding(Binding.Name, IE_Pressed);
+		FInputActionBinding releasedBinding(Binding.Name, IE_Released);
+
+		pressedBinding.bConsumeInput = false;
+		pressedBinding.ActionDelegate.GetDelegateForManualSet().BindLambda([record]() { record(UnrealCLRFramework::InputEventType::Pressed, 1.0f); });
+
+		releasedBinding.bConsumeInput = false;
+		releasedBinding.ActionDelegate.GetDelegateForManualSet().BindLambda([record]() { record(UnrealCLRFramework::InputEventType::Released, 0.0f); });
+
+		inputComponent->AddActionBinding(pressedBinding);
+		inputComponent->AddActionBinding(releasedBinding);
+	}
+}
+
+void UnrealCLR::WorldContext::RebuildInputBindings() {
+	for (const TPair<TWeakObjectPtr<APlayerController>, InputTarget>& target : InputTargets) {
+		UInputComponent* inputComponent = target.Value.Component.Get();
+
+		if (!inputComponent)
+			continue;
+
+		inputComponent->ClearActionBindings();
+		inputComponent->AxisBindings.Reset();
+
+		for (const InputBinding& binding : InputBindings) {
+			AddInputBinding(target.Value, binding);
+		}
+	}
+}
+
+void UnrealCLR::WorldContext::UpdateInputTargets() {
+	for (auto target = InputTargets.CreateIterator(); target; ++target) {
+		if (!target.Key().IsValid() || !target.Value().Component.IsValid())
+			target.RemoveCurrent();
+	}
+
+	// Local players can join at any time, each of them receives an input component with all bindings
+
+	for (FConstPlayerControllerIterator iterator = World->GetPlayerControllerIterator(); iterator; ++iterator) {
+		APlayerController* playerController = iterator->Get();
+
+		if (!playerController || !playerController->IsLocalController() || InputTargets.Contains(playerController))
+			continue;
+
+		UInputComponent* inputComponent = NewObject<UInputComponent>(playerController, TEXT("UnrealCLRInputComponent"));
+		ULocalPlayer* localPlayer = playerController->GetLocalPlayer();
+		InputTarget& target = InputTargets.Add(playerController);
+
+		target.Component = inputComponent;
+		target.Player = localPlayer ? localPlayer->GetControllerId() : 0;
+
+		inputComponent->RegisterComponent();
+
+		for (const InputBinding& binding : InputBindings) {
+			AddInputBinding(target, binding);
+		}
+
+		playerController->PushInputComponent(inputComponent);
+	}
+}
+
+void UnrealCLR::WorldContext::DispatchInput(int32 Event) {
+	if (Event != InputTickGroup || (InputEvents.Num() == 0 && InputEventsDropped == 0))
+		return;
+
+	if (Shared::InputHandler) {
+		DeliveredInputEvents.Events = InputEvents.GetData();
+		DeliveredInputEvents.Count = InputEvents.Num();
+		DeliveredInputEvents.Dropped = InputEventsDropped;
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(Shared::InputHandler, &DeliveredInputEvents));
+		UnrealCLR::ManagedTelemetry.Attribute(Event);
+	}
+
+	InputEvents.Reset();
+	InputEventsDropped = 0;
+}
+
+void UnrealCLR::WorldContext::ReleaseInput() {
+	for (const TPair<TWeakObjectPtr<APlayerController>, InputTarget>& target : InputTargets) {
+		APlayerController* playerController = target.Key.Get();
+		UInputComponent* inputComponent = target.Value.Component.Get();
+
+		if (playerController && inputComponent)
+			playerController->PopInputComponent(inputComponent);
+
+		if (inputComponent)
+			inputComponent->DestroyComponent();
+	}
+
+	InputTargets.Empty();
+	InputBindings.Empty();
+	InputEvents.Empty();
+	InputEventsDropped = 0;
+}
+
+void UnrealCLR::WorldContext::DrainMutations(int32 Event) {
+	if (Event - OnWorldPrePhysicsTick != FMath::Clamp(CVarMutationQueueTickGroup.GetValueOnGameThread(), 0, OnWorldPostUpdateTick - OnWorldPrePhysicsTick))
+		return;
+
+	const int32 count = Mutations.Peek();
+
+	INC_DWORD_STAT_BY(STAT_MutationQueueDepth, count);
+	INC_DWORD_STAT_BY(STAT_MutationQueueStalls, FPlatformAtomics::InterlockedExchange(&Mutations.Stalls, 0));
+
+	if (count == 0 || !Shared::MutationHandler)
+		return;
+
+	// Each world executes only its own mutations and leaves the rest in place for the drain of their world, mutations of ended worlds are discarded
+
+	for (int32 index = 0; index < count; index++) {
+		MutationQueue::Entry& entry = Mutations.Entries[(Mutations.DequeuePosition + index) & (Mutations.Capacity - 1)];
+
+		if (entry.Dispatcher && entry.Context != Id && !FindWorldContext(entry.Context))
+			entry.Dispatcher = nullptr;
+	}
+
+	DrainedMutations.Position = Mutations.DequeuePosition;
+	DrainedMutations.Count = count;
+	DrainedMutations.Processed = 0;
+	DrainedMutations.Latency = 0.0f;
+	DrainedMutations.Context = Id;
+
+	UnrealCLR::ManagedCommand(UnrealCLR::Command(Shared::MutationHandler, &DrainedMutations));
+	UnrealCLR::ManagedTelemetry.Attribute(Event);
+
+	// Executed mutations are cleared by the handler, the queue advances up to the first one that is left, mutations that follow the failed one are left for the next drain
+
+	int32 executed = 0;
+
+	while (executed < count && !Mutations.Entries[(Mutations.DequeuePosition + executed) & (Mutations.Capacity - 1)].Dispatcher) {
+		executed++;
+	}
+
+	Mutations.Consume(executed);
+
+	INC_DWORD_STAT_BY(STAT_MutationsDrained, DrainedMutations.Processed);
+	INC_FLOAT_STAT_BY(STAT_MutationDrainLatency, DrainedMutations.Latency);
+}
+
+void UnrealCLR::WorldContext::Step(int32 Event, float DeltaTime) {
+	FixedStep& fixedStep = FixedSteps[Event - OnWorldPrePhysicsTick];
+
+	if (!fixedStep.Function)
+		return;
+
+	const int32 maxSubsteps = fixedStep.MaxSubsteps > 0 ? fixedStep.MaxSubsteps : FMath::Max(CVarFixedStepMaxSubsteps.GetValueOnGameThread(), 1);
+
+	fixedStep.Accumulator += DeltaTime;
+	fixedStep.Substeps = FMath::Min((int32)(fixedStep.Accumulator / fixedStep.StepSize), maxSubsteps);
+	fixedStep.Accumulator -= fixedStep.Substeps * (double)fixedStep.StepSize;
+
+	if (fixedStep.Accumulator >= fixedStep.StepSize) {
+		const double dropped = fixedStep.Accumulator - FMath::Fmod(fixedStep.Accumulator, (double)fixedStep.StepSize);
+
+		fixedStep.Accumulator -= dropped;
+
+		INC_FLOAT_STAT_BY(STAT_FixedStepTimeDropped, (float)(dropped * 1000.0));
+	}
+
+	fixedStep.Alpha = (float)(fixedStep.Accumulator / fixedStep.StepSize);
+
+	if (fixedStep.Substeps > 0) {
+		INC_DWORD_STAT_BY(STAT_FixedSubsteps, fixedStep.Substeps);
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(fixedStep.Function, &fixedStep));
+		UnrealCLR::ManagedTelemetry.Attribute(Event);
+	}
+}
+
+void UnrealCLR::WorldContext::Enter() {
+	UnrealCLR::Engine::World = World;
+	UnrealCLR::Engine::Manager = Manager;
+	UnrealCLR::Engine::Context = this;
+	UnrealCLR::Mutations.Context = Id;
+	UnrealCLR::DebugDrawBuffers.Context = Id;
+}
+
+void UnrealCLR::WorldContext::Invoke(int32 Event, Argument Value) {
+	TArray<Subscriber>& subscribers = Events[Event];
+
+	DispatchingEvent = Event;
+
+	for (const Subscriber& subscriber : subscribers) {
+		if (subscriber.Function && Shared::SubscriberStates[subscriber.Id]) {
+			UnrealCLR::ManagedCommand(UnrealCLR::Command(subscriber.Function, Value));
+			UnrealCLR::ManagedTelemetry.Attribute(Event);
+		}
+	}
+
+	DispatchingEvent = INDEX_NONE;
+
+	if (PendingRemoval) {
+		subscribers.RemoveAll([](const Subscriber& Value) { return !Value.Function; });
+
+		PendingRemoval = false;
+	}
+
+	for (const Subscriber& subscriber : PendingSubscribers) {
+		InsertSubscriber(subscribers, subscriber);
+	}
+
+	PendingSubscribers.Reset();
+}
+
+void UnrealCLR::Telemetry::Publish() {
+	int64 eventsAllocatedBytes = 0;
+
+	for (int32 event = 0; event < EventsCount; event++) {
+		if (event < OnWorldPrePhysicsTick || event > OnWorldPostUpdateTick)
+			eventsAllocatedBytes += EventAllocatedBytes[event];
+	}
+
+	SET_MEMORY_STAT(STAT_ManagedHeapSize, HeapSize);
+	SET_MEMORY_STAT(STAT_ManagedHeapCommitted, CommittedSize);
+	SET_MEMORY_STAT(STAT_ManagedHeapFragmented, FragmentedSize);
+	SET_MEMORY_STAT(STAT_ManagedFrameAllocated, FrameAllocatedBytes);
+	SET_MEMORY_STAT(STAT_ManagedPrePhysicsAllocated, EventAllocatedBytes[OnWorldPrePhysicsTick]);
+	SET_MEMORY_STAT(STAT_ManagedDuringPhysicsAllocated, EventAllocatedBytes[OnWorldDuringPhysicsTick]);
+	SET_MEMORY_STAT(STAT_ManagedPostPhysicsAllocated, EventAllocatedBytes[OnWorldPostPhysicsTick]);
+	SET_MEMORY_STAT(STAT_ManagedPostUpdateAllocated, EventAllocatedBytes[OnWorldPostUpdateTick]);
+	SET_MEMORY_STAT(STAT_ManagedEventsAllocated, eventsAllocatedBytes);
+	SET_FLOAT_STAT(STAT_ManagedPauseDuration, PauseDuration);
+	SET_DWORD_STAT(STAT_ManagedGen0Collections, Collections[0]);
+	SET_DWORD_STAT(STAT_ManagedGen1Collections, Collections[1]);
+	SET_DWORD_STAT(STAT_ManagedGen2Collections, Collections[2]);
+
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedHeapSizeMB, (float)((double)HeapSize / (1024.0 * 1024.0)), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedFrameAllocatedKB, (float)((double)FrameAllocatedBytes / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedPrePhysicsAllocatedKB, (float)((double)EventAllocatedBytes[OnWorldPrePhysicsTick] / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedDuringPhysicsAllocatedKB, (float)((double)EventAllocatedBytes[OnWorldDuringPhysicsTick] / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedPostPhysicsAllocatedKB, (float)((double)EventAllocatedBytes[OnWorldPostPhysicsTick] / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedPostUpdateAllocatedKB, (float)((double)EventAllocatedBytes[OnWorldPostUpdateTick] / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, ManagedEventsAllocatedKB, (float)((double)eventsAllocatedBytes / 1024.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, GCPauseMs, PauseDuration, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, GCGen0Collections, Collections[0], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, GCGen1Collections, Collections[1], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UnrealCLR, GCGen2Collections, Collections[2], ECsvCustomStatOp::Set);
+
+	FMemory::Memzero(EventAllocatedBytes);
+}
+
+bool UnrealCLR::Capture::Start(const FString& Path) {
+	Writer = IFileManager::Get().CreateFileWriter(*Path);
+
+	if (!Writer)
+		return false;
+
+	HostCommand = ManagedCommand;
+	ManagedCommand = &Capture::Command;
+
+	return true;
+}
+
+void UnrealCLR::Capture::Stop() {
+	if (Recording)
+		Flush();
+
+	Recording = false;
+
+	delete Writer;
+
+	Writer = nullptr;
+	ManagedCommand = HostCommand;
+	HostCommand = nullptr;
+
+	Buffer.Empty();
+}
+
+void UnrealCLR::Capture::Begin() {
+	Buffer.Reset();
+	Buffer.Reserve(bufferSize);
+
+	StartCycles = FPlatformTime::Cycles64();
+	Recording = true;
+
+	Write("UCLRCAP", 8);
+	Write(version);
+	Write(Checksum);
+	Write((uint16)Bindings.Num());
+
+	// Functions are identified by their table and index, so the replay can bind stubs to the same slots
+
+	for (const Binding& binding : Bindings) {
+		int16 table = -1;
+		int16 index = -1;
+
+		for (int32 i = 0; i < UE_ARRAY_COUNT(Shared::RuntimeFunctions); i++) {
+			if (Shared::RuntimeFunctions[i] == binding.Pointer)
+				index = i;
+		}
+
+		for (int32 i = 0; index < 0 && Shared::Functions[i]; i++) {
+			void** functions = (void**)Shared::Functions[i];
+
+			for (int32 j = 0; j < Shared::storageSize; j++) {
+				if (functions[j] == binding.Pointer) {
+					table = i;
+					index = j;
+
+					break;
+				}
+			}
+		}
+
+		const uint16 nameLength = (uint16)FCStringAnsi::Strlen(binding.Name);
+		const uint16 signatureLength = (uint16)FCStringAnsi::Strlen(binding.Signature);
+
+		Write(table);
+		Write(index);
+		Write(nameLength);
+		Write(binding.Name, nameLength);
+		Write(signatureLength);
+		Write(binding.Signature, signatureLength);
+	}
+}
+
+void UnrealCLR::Capture::Flush() {
+	Writer->Serialize(Buffer.GetData(), Buffer.Num());
+	Buffer.Reset();
+}
+
+void* UnrealCLR::Capture::Command(UnrealCLR::Command Value) {
+	if (!Recording) {
+		if (Value.Type != CommandType::LoadAssemblies)
+			return HostCommand(Value);
+
+		Begin();
+	}
+
+	if (Value.Type == CommandType::Trace || !IsInGameThread())
+		return HostCommand(Value);
+
+	Write(RecordType::CommandBegin);
+	Write(Timestamp());
+	Write(Value.Type);
+
+	if (Value.Type == CommandType::Find) {
+		const uint16 length = (uint16)FCStringAnsi::Strlen(Value.Method);
+
+		Write(length);
+		Write(Value.Method, length);
+		Write(Value.Optional);
+	} else {
+		Write(Value.Function);
+		Write(Value.Value.Type);
+		Write(Value.Value.Pointer);
+
+		if (Value.Value.Type == ArgumentType::Callback) {
+			const CallbackType type = Value.Value.Callback.Type;
+			const uint8 count = type == CallbackType::ActorHitDelegate || type == CallbackType::ComponentHitDelegate ? 4 : type == CallbackType::ActorCursorDelegate || type == CallbackType::ComponentCursorDelegate || type == CallbackType::CharacterLandedDelegate ? 1 : 2;
+
+			Write(type);
+			Write(count);
+			Write(Value.Value.Callback.Parameters, count * sizeof(void*));
+		}
+	}
+
+	const uint64 start = Timestamp();
+	void* result = HostCommand(Value);
+
+	Write(RecordType::CommandEnd);
+	Write(Timestamp() - start);
+	Write(result);
+
+	if (Value.Type == CommandType::UnloadAssemblies)
+		Stop();
+
+	return result;
+}
+
+uint16 UnrealCLR::Capture::Register(const ANSICHAR* Name, const ANSICHAR* Signature, void* Pointer) {
+	return (uint16)Bindings.Add({ Name, Signature, Pointer });
+}
+
+uint64 UnrealCLR::Capture::Timestamp() {
+	return (uint64)(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1e9);
+}
+
+void UnrealCLR::Arena::Initialize(int64 Size) {
+	Buffer = (uint8*)FMemory::Malloc(Size, 16);
+	Capacity = Size;
+	Offset = 0;
+	HighWaterMark = 0;
+	Generation = 0;
+	Overflows = 0;
+}
+
+void UnrealCLR::Arena::Release() {
+	FMemory::Free(Buffer);
+
+	Buffer = nullptr;
+	Capacity = 0;
+	Offset = 0;
+}
+
+void UnrealCLR::Arena::Reset() {
+	const int64 used = Offset;
+
+	if (used > HighWaterMark)
+		HighWaterMark = used;
+
+	SET_MEMORY_STAT(STAT_FrameArenaUsed, FMath::Min(used, Capacity));
+	SET_MEMORY_STAT(STAT_FrameArenaHighWaterMark, HighWaterMark);
+	SET_DWORD_STAT(STAT_FrameArenaOverflows, Overflows);
+
+	Offset = 0;
+	Overflows = 0;
+	Generation++;
+}
+
+void* UnrealCLR::Arena::Allocate(int64 Size) {
+	// The arena is reset by the game thread at the end of the frame, other threads take the fallback of the caller
+
+	if (!IsInGameThread())
+		return nullptr;
+
+	const int64 size = Align(Size, 8);
+	const int64 offset = FPlatformAtomics::InterlockedAdd(&Offset, size);
+
+	if (offset + size > Capacity) {
+		FPlatformAtomics::InterlockedIncrement(&Overflows);
+
+		return nullptr;
+	}
+
+	return Buffer + offset;
+}
+
+UnrealCLR::ArenaString<char> UnrealCLR::Arena::CopyString(const TCHAR* Source) {
+	FTCHARToUTF8 converter(Source);
+
+	const int32 length = converter.Length();
+	ArenaString<char> result;
+	char* string = (char*)Allocate(length + 1);
+
+	// Strings that don't fit are owned by the result, so each call keeps its own fallback
+
+	if (!string) {
+		result.Overflow.SetNumUninitialized(length + 1);
+		string = result.Overflow.GetData();
+	}
+
+	FMemory::Memcpy(string, converter.Get(), length);
+
+	string[length] = '\0';
+	result.Data = string;
+
+	return result;
+}
+
+UnrealCLR::ArenaString<TCHAR> UnrealCLR::Arena::ConvertString(const char* Source) {
+	FUTF8ToTCHAR converter(Source);
+
+	const int32 length = converter.Length();
+	ArenaString<TCHAR> result;
+	TCHAR* string = (TCHAR*)Allocate((length + 1) * sizeof(TCHAR));
+
+	if (!string) {
+		result.Overflow.SetNumUninitialized(length + 1);
+		string = result.Overflow.GetData();
+	}
+
+	FMemory::Memcpy(string, converter.Get(), length * sizeof(TCHAR));
+
+	string[length] = TEXT('\0');
+	result.Data = string;
+
+	return result;
+}
+
+void UnrealCLR::DebugDraw::Initialize(int64 Size) {
+	#if !ENABLE_DRAW_DEBUG
+		Size = 0;
+	#endif
+
+	for (DebugDrawBuffer& buffer : Buffers) {
+		buffer.Data = Size > 0 ? (uint8*)FMemory::Malloc(Size, 16) : nullptr;
+		buffer.Capacity = buffer.Data ? Size : 0;
+		buffer.Offset = 0;
+		buffer.Writers = 0;
+		buffer.Overflows = 0;
+	}
+
+	Current = 0;
+	Context = 0;
+}
+
+void UnrealCLR::DebugDraw::Release() {
+	for (DebugDrawBuffer& buffer : Buffers) {
+		FMemory::Free(buffer.Data);
+
+		buffer.Data = nullptr;
+		buffer.Capacity = 0;
+	}
+}
+
+void UnrealCLR::TextureUploads::Dispatch(bool Flush) {
+	if (Pending == 0)
+		return;
+
+	// Pixels of pending uploads are pinned in managed memory until the rendering thread copies them
+
+	if (Flush)
+		FlushRenderingCommands();
+
+	int32 id;
+
+	while (Completed.Dequeue(id)) {
+		Released.Add(id);
+	}
+
+	Pending -= Released.Num();
+
+	if (Released.Num() > 0 && Shared::TextureUploadHandler) {
+		ReleasedBatch.Ids = Released.GetData();
+		ReleasedBatch.Count = Released.Num();
+
+		UnrealCLR::ManagedCommand(UnrealCLR::Command(Shared::TextureUploadHandler, &ReleasedBatch));
+	}
+
+	Released.Reset();
+}
+
+void UnrealCLR::DebugDraw::Reset() {
+	for (DebugDrawBuffer& buffer : Buffers) {
+		FPlatformAtomics::AtomicStore(&buffer.Offset, (int64)0);
+		FPlatformAtomics::InterlockedExchange(&buffer.Overflows, 0);
+	}
+}
+
+void UnrealCLR::DebugDraw::Submit(UWorld* World, int32 Id) {
+	#if ENABLE_DRAW_DEBUG
+		using namespace UnrealCLRFramework;
+
+		DebugDrawBuffer& buffer = Buffers[Current];
+		DebugDrawBuffer& nextBuffer = Buffers[Current ^ 1];
+
+		if (buffer.Capacity == 0)
+			return;
+
+		FPlatformAtomics::InterlockedExchange(&Current, Current ^ 1);
+
+		// Writers that entered the buffer before the swap are waited out, a record takes nanoseconds to write
+
+		while (FPlatformAtomics::AtomicRead(&buffer.Writers) != 0) {
+			FPlatformProcess::YieldThread();
+		}
+
+		static TArray<FBatchedLine> lines[3];
+
+		ULineBatchComponent* lineBatchers[3] = { World->LineBatcher, World->PersistentLineBatcher, World->ForegroundLineBatcher };
+		const int64 size = FMath::Min((int64)buffer.Offset, buffer.Capacity);
+		int32 records = 0;
+
+		auto addLine = [&lines, &lineBatchers](const DebugDrawStyle& Style, const FVector& Start, const FVector& End) {
+			const int32 index = Style.DepthPriority == SDPG_Foreground ? 2 : (Style.Persistent || Style.LifeTime > 0.0f ? 1 : 0);
+
+			if (lineBatchers[index])
+				lines[index].Emplace(Start, End, FLinearColor(FColor(Style.DrawColor)), Style.Persistent ? -1.0f : (Style.LifeTime > 0.0f ? Style.LifeTime : lineBatchers[index]->DefaultLifeTime), Style.Thickness, Style.DepthPriority);
+		};
+
+		auto submitLines = [&lines, &lineBatchers]() {
+			for (int32 index = 0; index < 3; index++) {
+				if (lines[index].Num() > 0) {
+					lineBatchers[index]->DrawLines(lines[index]);
+					lines[index].Reset();
+				}
+			}
+		};
+
+		for (int64 offset = 0; offset + (int64)sizeof(DebugDrawHeader) <= size;) {
+			const DebugDrawHeader* header = (const DebugDrawHeader*)(buffer.Data + offset);
+
+			if (header->Size < (int32)sizeof(DebugDrawHeader) || offset + header->Size > size)
+				break;
+
+			const void* record = header + 1;
+
+			offset += header->Size;
+
+			// Records of other worlds are carried over to the next buffer and submitted by the tick of their world, records of ended worlds are dropped
+
+			if (header->Context != Id) {
+				if (FindWorldContext(header->Context)) {
+					const int64 position = FPlatformAtomics::InterlockedAdd(&nextBuffer.Offset, (int64)header->Size);
+
+					if (position + header->Size <= nextBuffer.Capacity) {
+						FMemory::Memcpy(nextBuffer.Data + position, header, header->Size);
+					} else {
+						if (position + (int64)sizeof(DebugDrawHeader) <= nextBuffer.Capacity)
+							((DebugDrawHeader*)(nextBuffer.Data + position))->Size = 0;
+
+						FPlatformAtomics::InterlockedIncrement(&nextBuffer.Overflows);
+					}
+				}
+
+				continue;
+			}
+
+			records++;
+
+			switch (header->Type) {
+				case DebugDrawType::Line: {
+					const DebugLine* line = (const DebugLine*)record;
+
+					addLine(line->Style, line->Start, line->End);
+
+					break;
+				}
+
+				case DebugDrawType::Point: {
+					const DebugPoint* point = (const DebugPoint*)record;
+
+					DrawDebugPoint(World, point->Location, point->Size, point->Style.DrawColor, point->Style.Persistent, point->Style.LifeTime, point->Style.DepthPriority);
+
+					break;
+				}
+
+				case DebugDrawType::Box: {
+					const DebugBox* box = (const DebugBox*)record;
+					const FQuat rotation = box->Rotation;
+					const FVector center = box->Center;
+					const FVector extent = box->Extent;
+
+					static constexpr int32 edges[12][2] = { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, { 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+
+					FVector corners[8];
+
+					for (int32 corner = 0; corner < 8; corner++) {
+						corners[corner] = center + rotation.RotateVector(FVector(corner & 1 ? extent.X : -extent.X, corner & 2 ? extent.Y : -extent.Y, corner & 4 ? extent.Z : -extent.Z));
+					}
+
+					for (const int32* edge : edges) {
+						addLine(box->Style, corners[edge[0]], corners[edge[1]]);
+					}
+
+					break;
+				}
+
+				case DebugDrawType::Capsule: {
+					const DebugCapsule* capsule = (const DebugCapsule*)record;
+
+					DrawDebugCapsule(World, capsule->Center, capsule->HalfHeight, capsule->Radius, capsule->Rotation, capsule->Style.DrawColor, capsule->Style.Persistent, capsule->Style.LifeTime, capsule->Style.DepthPriority, capsule->Style.Thickness);
+
+					break;
+				}
+
+				case DebugDrawType::Cone: {
+					const DebugCone* cone = (const DebugCone*)record;
+
+					DrawDebugCone(World, cone->Origin, cone->Direction, cone->Length, cone->AngleWidth, cone->AngleHeight, cone->Sides, cone->Style.DrawColor, cone->Style.Persistent, cone->Style.LifeTime, cone->Style.DepthPriority, cone->Style.Thickness);
+
+					break;
+				}
+
+				case DebugDrawType::Cylinder: {
+					const DebugCylinder* cylinder = (const DebugCylinder*)record;
+
+					DrawDebugCylinder(World, cylinder->Start, cylinder->End, cylinder->Radius, cylinder->Segments, cylinder->Style.DrawColor, cylinder->Style.Persistent, cylinder->Style.LifeTime, cylinder->Style.DepthPriority, cylinder->Style.Thickness);
+
+					break;
+				}
+
+				case DebugDrawType::Sphere: {
+					const DebugSphere* sphere = (const DebugSphere*)record;
+
+					DrawDebugSphere(World, sphere->Center, sphere->Radius, sphere->Segments, sphere->Style.DrawColor, sphere->Style.Persistent, sphere->Style.LifeTime, sphere->Style.DepthPriority, sphere->Style.Thickness);
+
+					break;
+				}
+
+				case DebugDrawType::Message: {
+					const DebugMessage* message = (const DebugMessage*)record;
+					FUTF8ToTCHAR text((const ANSICHAR*)(message + 1), message->Length);
+
+					GEngine->AddOnScreenDebugMessage((uint64)message->Key, message->TimeToDisplay, message->DisplayColor, FString(text.Length(), text.Get()));
+
+					break;
+				}
+
+				case DebugDrawType::ClearMessages: {
+					GEngine->ClearOnScreenDebugMessages();
+
+					break;
+				}
+
+				case DebugDrawType::FlushPersistentLines: {
+					submitLines();
+					FlushPersistentDebugLines(World);
+
+					break;
+				}
+			}
+		}
+
+		submitLines();
+
+		FPlatformAtomics::AtomicStore(&buffer.Offset, (int64)0);
+
+		INC_DWORD_STAT_BY(STAT_DebugDrawRecords, records);
+		INC_DWORD_STAT_BY(STAT_DebugDrawOverflows, FPlatformAtomics::InterlockedExchange(&buffer.Overflows, 0));
+	#endif
+}
+
+void UnrealCLR::MutationQueue::Initialize(int32 Size) {
+	Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(Size, cacheLineSize));
+	Entries = (Entry*)FMemory::Malloc(Capacity * sizeof(Entry), cacheLineSize);
+	Stalls = 0;
+	Context = 0;
+	EnqueuePosition = 0;
+	DequeuePosition = 0;
+
+	for (int64 index = 0; index < Capacity; index++) {
+		Entries[index].Sequence = index;
+	}
+}
+
+void UnrealCLR::MutationQueue::Release() {
+	FMemory::Free(Entries);
+
+	Entries = nullptr;
+	Capacity = 0;
+}
+
+int32 UnrealCLR::MutationQueue::Peek() const {
+	int32 count = 0;
+
+	// Entries become visible to the consumer in order of publication, so the scan stops at the first entry that is still being written
+
+	while (count < Capacity) {
+		const int64 position = DequeuePosition + count;
+
+		if (FPlatformAtomics::AtomicRead(&Entries[position & (Capacity - 1)].Sequence) != position + 1)
+			break;
+
+		count++;
+	}
+
+	return count;
+}
+
+void UnrealCLR::MutationQueue::Consume(int32 Count) {
+	for (int32 index = 0; index < Count; index++) {
+		const int64 position = DequeuePosition + index;
+
+		FPlatformAtomics::AtomicStore(&Entries[position & (Capacity - 1)].Sequence, position + Capacity);
+	}
+
+	DequeuePosition += Count;
+}
+
+void UnrealCLR::TimerWheel::Initialize(double Time) {
+	Release();
+
+	Current = (int64)(Time * resolution);
+}
+
+void UnrealCLR::TimerWheel::Release() {
+	Timers.Empty();
+	FreeTimers.Empty();
+	Expired.Empty();
+
+	for (int32& slot : Slots) {
+		slot = INDEX_NONE;
+	}
+
+	FMemory::Memzero(Occupied);
+
+	Current = 0;
+	Count = 0;
+}
+
+int32 UnrealCLR::TimerWheel::Schedule(double Delay, double Period, int32 Id) {
+	int32 index = INDEX_NONE;
+
+	if (FreeTimers.Num() > 0) {
+		index = FreeTimers.Pop(false);
+	} else if (Timers.Num() <= indexMask) {
+		index = Timers.AddUninitialized();
+		Timers[index].Generation = 0;
+	} else {
+		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Maximum number of %d timers is reached"), ANSI_TO_TCHAR(__FUNCTION__), indexMask + 1);
+
+		return -1;
+	}
+
+	Timer& timer = Timers[index];
+
+	timer.Expiry = Current + FMath::Max((int64)(Delay * resolution), (int64)1);
+	timer.Period = Period > 0.0 ? FMath::Max((int64)(Period * resolution), (int64)1) : 0;
+	timer.Id = Id;
+
+	Link(index);
+
+	Count++;
+
+	return (timer.Generation << indexBits) | index;
+}
+
+bool UnrealCLR::TimerWheel::Cancel(int32 Handle) {
+	if (!Find(Handle))
+		return false;
+
+	const int32 index = Handle & indexMask;
+
+	Unlink(index);
+	Free(index);
+
+	return true;
+}
+
+bool UnrealCLR::TimerWheel::IsScheduled(int32 Handle) const {
+	const int32 index = Handle & indexMask;
+
+	return Handle >= 0 && Timers.IsValidIndex(index) && Timers[index].Slot != INDEX_NONE && Timers[index].Generation == Handle >> indexBits;
+}
+
+double UnrealCLR::TimerWheel::GetRemaining(int32 Handle) const {
+	if (!IsScheduled(Handle))
+		return 0.0;
+
+	return (double)(Timers[Handle & indexMask].Expiry - Current) / resolution;
+}
+
+void UnrealCLR::TimerWheel::Advance(double Time) {
+	const int64 target = (int64)(Time * resolution);
+
+	while (Current < target) {
+		if (Count == 0) {
+			Current = target;
+
+			break;
+		}
+
+		Current++;
+
+		for (int32 level = 1; level <= levelsCount && (Current & (((int64)1 << (level * slotBits)) - 1)) == 0; level++) {
+			Cascade(level);
+		}
+
+		const int32 slot = (int32)(Current & (slotsCount - 1));
+
+		if (!(Occupied[0] & ((uint64)1 << slot)))
+			continue;
+
+		int32 index = Slots[slot];
+
+		while (index != INDEX_NONE) {
+			const int32 next = Timers[index].Next;
+			Timer& timer = Timers[index];
+
+			Expired.Add(timer.Id);
+			Unlink(index);
+
+			if (timer.Period > 0) {
+				timer.Expiry += timer.Period;
+
+				Link(index);
+			} else {
+				Free(index);
+			}
+
+			index = next;
+		}
+	}
+}
+
+UnrealCLR::TimerWheel::Timer* UnrealCLR::TimerWheel::Find(int32 Handle) {
+	return IsScheduled(Handle) ? &Timers[Handle & indexMask] : nullptr;
+}
+
+void UnrealCLR::TimerWheel::Link(int32 Index) {
+	Timer& timer = Timers[Index];
+	int32 level = 0;
+
+	while (level < levelsCount && (timer.Expiry >> ((level + 1) * slotBits)) != (Current >> ((level + 1) * slotBits))) {
+		level++;
+	}
+
+	// Timers beyond the range of the top level are kept in a single overflow list that is re-linked when the range wraps
+
+	const int32 slot = level < levelsCount ? (int32)((timer.Expiry >> (level * slotBits)) & (slotsCount - 1)) : 0;
+	const int32 head = level * slotsCount + slot;
+
+	timer.Slot = head;
+	timer.Previous = INDEX_NONE;
+	timer.Next = Slots[head];
+
+	if (timer.Next != INDEX_NONE)
+		Timers[timer.Next].Previous = Index;
+
+	Slots[head] = Index;
+	Occupied[level] |= (uint64)1 << slot;
+}
+
+void UnrealCLR::TimerWheel::Unlink(int32 Index) {
+	Timer& timer = Timers[Index];
+
+	if (timer.Previous != INDEX_NONE)
+		Timers[timer.Previous].Next = timer.Next;
+	else
+		Slots[timer.Slot] = timer.Next;
+
+	if (timer.Next != INDEX_NONE)
+		Timers[timer.Next].Previous = timer.Previous;
+
+	if (Slots[timer.Slot] == INDEX_NONE)
+		Occupied[timer.Slot / slotsCount] &= ~((uint64)1 << (timer.Slot % slotsCount));
+
+	timer.Slot = INDEX_NONE;
+}
+
+void UnrealCLR::TimerWheel::Free(int32 Index) {
+	Timer& timer = Timers[Index];
+
+	timer.Slot = INDEX_NONE;
+	timer.Generation = (timer.Generation + 1) & generationMask;
+
+	FreeTimers.Add(Index);
+
+	Count--;
+}
+
+void UnrealCLR::TimerWheel::Cascade(int32 Level) {
+	const int32 slot = Level < levelsCount ? (int32)((Current >> (Level * slotBits)) & (slotsCount - 1)) : 0;
+	const int32 head = Level * slotsCount + slot;
+	int32 index = Slots[head];
+
+	Slots[head] = INDEX_NONE;
+	Occupied[Level] &= ~((uint64)1 << slot);
+
+	while (index != INDEX_NONE) {
+		const int32 next = Timers[index].Next;
+
+		Link(index);
+
+		index = next;
+	}
+}
+
+FString UnrealCLR::PrePhysicsTickFunction::DiagnosticMessage() {
+	return TEXT("PrePhysicsTickFunction");
+}
+
+FString UnrealCLR::DuringPhysicsTickFunction::DiagnosticMessage() {
+	return TEXT("DuringPhysicsTickFunction");
+}
+
+FString UnrealCLR::PostPhysicsTickFunction::DiagnosticMessage() {
+	return TEXT("PostPhysicsTickFunction");
+}
+
+FString UnrealCLR::PostUpdateTickFunction::DiagnosticMessage() {
+	return TEXT("PostUpdateTickFunction");
+}
+
+FString UnrealCLR::SystemTickFunction::DiagnosticMessage() {
+	return TEXT("SystemTickFunction");
 }
 
 #undef LOCTEXT_NAMESPACE
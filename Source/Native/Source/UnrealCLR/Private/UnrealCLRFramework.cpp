@@ -22,6 +22,7 @@
  */
 
 #include "UnrealCLRFramework.h"
+#include "UnrealCLR.h"
 
 DEFINE_LOG_CATEGORY(LogUnrealManaged);
 
@@ -101,7 +102,7 @@ namespace UnrealCLRFramework {
 
 	namespace Assert {
 		void OutputMessage(const char* Message) {
-			FString message(UTF8_TO_TCHAR(Message));
+			const UnrealCLR::ArenaString<TCHAR> message = UnrealCLR::FrameArena.ConvertString(Message);
 
 			UE_LOG(LogUnrealManaged, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *message);
 
@@ -110,24 +111,20 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace CommandLine {
-		void Get(char* Arguments) {
-			const char* arguments = TCHAR_TO_UTF8(FCommandLine::Get());
-
-			UnrealCLR::Utility::Strcpy(Arguments, arguments, UnrealCLR::Utility::Strlen(arguments));
-		}
-
 		void Set(const char* Arguments) {
-			FCommandLine::Set(UTF8_TO_TCHAR(Arguments));
+			FCommandLine::Set(*UnrealCLR::FrameArena.ConvertString(Arguments));
+			Application::PublishEnvironment();
 		}
 
 		void Append(const char* Arguments) {
-			FCommandLine::Append(UTF8_TO_TCHAR(Arguments));
+			FCommandLine::Append(*UnrealCLR::FrameArena.ConvertString(Arguments));
+			Application::PublishEnvironment();
 		}
 	}
 
 	namespace Debug {
 		void Log(LogLevel Level, const char* Message) {
-			#define UNREALCLR_FRAMEWORK_LOG(Verbosity) UE_LOG(LogUnrealManaged, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(UTF8_TO_TCHAR(Message)));
+			#define UNREALCLR_FRAMEWORK_LOG(Verbosity) UE_LOG(LogUnrealManaged, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *UnrealCLR::FrameArena.ConvertString(Message));
 
 			if (Level == LogLevel::Display) {
 				UNREALCLR_FRAMEWORK_LOG(Display);
@@ -141,67 +138,1469 @@ namespace UnrealCLRFramework {
 		}
 
 		void Exception(const char* Message) {
-			GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *FString(UTF8_TO_TCHAR(Message)));
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *UnrealCLR::FrameArena.ConvertString(Message));
+		}
+	}
+
+	namespace Application {
+		static Environment EnvironmentBlock;
+		static TArray<ANSICHAR> EnvironmentStrings;
+		static TArray<EnvironmentArgument> EnvironmentArguments;
+
+		static int32 AddEnvironmentString(const FString& Value) {
+			const int32 offset = EnvironmentStrings.Num();
+			FTCHARToUTF8 value(*Value);
+
+			EnvironmentStrings.Append(value.Get(), value.Length());
+			EnvironmentStrings.Add('\0');
+
+			return offset;
+		}
+
+		const Environment* GetEnvironment() {
+			if (EnvironmentBlock.Version == 0)
+				PublishEnvironment();
+
+			return &EnvironmentBlock;
+		}
+
+		void PublishEnvironment() {
+			TArray<FString> tokens;
+			TArray<FString> switches;
+
+			FCommandLine::Parse(FCommandLine::Get(), tokens, switches);
+
+			EnvironmentStrings.Reset();
+			EnvironmentArguments.Reset();
+
+			const int32 projectDirectory = AddEnvironmentString(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
+			const int32 defaultLanguage = AddEnvironmentString(FGenericPlatformMisc::GetDefaultLanguage());
+			const int32 projectName = AddEnvironmentString(FApp::GetProjectName());
+			const int32 commandLine = AddEnvironmentString(FCommandLine::Get());
+
+			TArray<TPair<int32, int32>, TInlineAllocator<32>> arguments;
+
+			for (const FString& currentSwitch : switches) {
+				FString key;
+				FString value;
+
+				if (currentSwitch.Split(TEXT("="), &key, &value))
+					arguments.Add(TPair<int32, int32>(AddEnvironmentString(key), AddEnvironmentString(value.TrimQuotes())));
+				else
+					arguments.Add(TPair<int32, int32>(AddEnvironmentString(currentSwitch), INDEX_NONE));
+			}
+
+			// Pointers are resolved after all strings are added since the storage may be reallocated
+
+			const ANSICHAR* strings = EnvironmentStrings.GetData();
+
+			for (const TPair<int32, int32>& argument : arguments) {
+				EnvironmentArguments.Add({ strings + argument.Key, argument.Value != INDEX_NONE ? strings + argument.Value : nullptr });
+			}
+
+			EnvironmentBlock.IsCanEverRender = FApp::CanEverRender();
+			EnvironmentBlock.IsPackagedForDistribution = FGenericPlatformMisc::IsPackagedForDistribution();
+
+			#if UE_BUILD_SHIPPING
+				EnvironmentBlock.IsPackagedForShipping = true;
+			#else
+				EnvironmentBlock.IsPackagedForShipping = false;
+			#endif
+
+			EnvironmentBlock.ProjectDirectory = strings + projectDirectory;
+			EnvironmentBlock.DefaultLanguage = strings + defaultLanguage;
+			EnvironmentBlock.ProjectName = strings + projectName;
+			EnvironmentBlock.CommandLine = strings + commandLine;
+			EnvironmentBlock.Arguments = EnvironmentArguments.GetData();
+			EnvironmentBlock.ArgumentsCount = EnvironmentArguments.Num();
+
+			FPlatformAtomics::InterlockedIncrement(&EnvironmentBlock.Version);
+		}
+
+		int64 GetInteropCalls() {
+			#if UNREALCLR_CAPTURE
+				return UnrealCLR::Capture::Calls;
+			#else
+				return 0;
+			#endif
+		}
+
+		float GetVolumeMultiplier() {
+			return FApp::GetVolumeMultiplier();
+		}
+
+		void SetProjectName(const char* ProjectName) {
+			FApp::SetProjectName(*UnrealCLR::FrameArena.ConvertString(ProjectName));
+			PublishEnvironment();
 		}
 
-		void AddOnScreenMessage(int32 Key, float TimeToDisplay, Color DisplayColor, const char* Message) {
-			GEngine->AddOnScreenDebugMessage((uint64)Key, TimeToDisplay, DisplayColor, *FString(UTF8_TO_TCHAR(Message)));
+		void SetVolumeMultiplier(float Value) {
+			FApp::SetVolumeMultiplier(Value);
 		}
 
-		void ClearOnScreenMessages() {
-			GEngine->ClearOnScreenDebugMessages();
+		void RequestExit(bool Force, int32 ReturnCode) {
+			FGenericPlatformMisc::RequestExitWithStatus(Force, static_cast<uint8>(ReturnCode));
 		}
 	}
 
-	namespace Application {
-		bool IsCanEverRender() {
-			return FApp::CanEverRender();
+	namespace World {
+		struct ActorIndex {
+			TMap<FName, TWeakObjectPtr<AActor>> Names;
+			TMultiMap<FName, TWeakObjectPtr<AActor>> Tags;
+			TMap<uint32, TWeakObjectPtr<AActor>> Ids;
+			TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+			bool Populated;
+			FDelegateHandle OnActorSpawnedHandle;
+			FDelegateHandle OnActorDestroyedHandle;
+			FDelegateHandle OnLevelAddedHandle;
+			FDelegateHandle OnLevelRemovedHandle;
+		};
+
+		static TAutoConsoleVariable<int32> CVarActorIndex(TEXT("clr.ActorIndex"), 1, TEXT("Resolves actors by name, tag, and ID through hash indexes of the world maintained from spawned and destroyed actors instead of iterating over all actors"), ECVF_Default);
+
+		static TMap<UWorld*, ActorIndex> ActorIndices;
+
+		struct PendingTraceBatch {
+			TWeakObjectPtr<UWorld> World;
+			TArray<FTraceHandle> Handles;
+			const TraceQuery* Queries;
+			Hit* Results;
+			uint64 Frame;
+		};
+
+		static constexpr int32 parallelTraceThreshold = 32;
+		static constexpr int32 traceBatchPending = -1;
+		static constexpr int32 traceBatchExpired = -2;
+
+		// The engine keeps results of asynchronous traces until the end of the next frame
+
+		static constexpr uint64 traceBatchLifetime = 2;
+
+		static TMap<int32, PendingTraceBatch> PendingTraceBatches;
+		static int32 PendingTraceBatchesHandle;
+
+		static FORCEINLINE void SetTraceMiss(const TraceQuery& Query, Hit& Result) {
+			FMemory::Memzero(&Result, sizeof(Hit));
+
+			Result.TraceStart = Query.Start;
+			Result.TraceEnd = Query.End;
+			Result.Time = 1.0f;
 		}
 
-		bool IsPackagedForDistribution() {
-			return FGenericPlatformMisc::IsPackagedForDistribution();
+		static FORCEINLINE FCollisionQueryParams GetQueryParams(const TraceQuery& Query) {
+			FCollisionQueryParams queryParams(FCollisionQueryParams::DefaultQueryParam);
+
+			queryParams.bTraceComplex = Query.TraceComplex;
+
+			if (Query.IgnoredActor)
+				queryParams.AddIgnoredActor(Query.IgnoredActor);
+
+			return queryParams;
 		}
 
-		bool IsPackagedForShipping() {
-			#if UE_BUILD_SHIPPING
-				return true;
-			#else
+		int32 TraceBatch(const TraceQuery* Queries, Hit* Results, int32 Count) {
+			UWorld* world = UnrealCLR::Engine::World;
+
+			if (!world) {
+				for (int32 i = 0; i < Count; i++) {
+					SetTraceMiss(Queries[i], Results[i]);
+				}
+
+				return 0;
+			}
+
+			std::atomic<int32> blockingHits(0);
+
+			ParallelFor(Count, [world, Queries, Results, &blockingHits](int32 Index) {
+				const TraceQuery& query = Queries[Index];
+				FHitResult hitResult;
+				bool blockingHit = false;
+
+				if (query.Shape.ShapeType == CollisionShapeType::Line)
+					blockingHit = world->LineTraceSingleByChannel(hitResult, query.Start, query.End, (ECollisionChannel)query.Channel, GetQueryParams(query));
+				else
+					blockingHit = world->SweepSingleByChannel(hitResult, query.Start, query.End, query.Rotation, (ECollisionChannel)query.Channel, query.Shape, GetQueryParams(query));
+
+				if (blockingHit) {
+					Results[Index] = hitResult;
+					Results[Index].TraceStart = query.Start;
+					Results[Index].TraceEnd = query.End;
+
+					blockingHits.fetch_add(1, std::memory_order_relaxed);
+				} else {
+					SetTraceMiss(query, Results[Index]);
+				}
+			}, Count < parallelTraceThreshold);
+
+			return blockingHits.load();
+		}
+
+		int32 SubmitTraceBatch(const TraceQuery* Queries, Hit* Results, int32 Count) {
+			UWorld* world = UnrealCLR::Engine::World;
+			const int32 handle = PendingTraceBatchesHandle++;
+			PendingTraceBatch& batch = PendingTraceBatches.Add(handle);
+
+			batch.World = world;
+			batch.Queries = Queries;
+			batch.Results = Results;
+			batch.Frame = GFrameCounter;
+
+			// A batch without a world is reported as expired on the first query
+
+			if (!world)
+				return handle;
+
+			batch.Handles.Reserve(Count);
+
+			for (int32 i = 0; i < Count; i++) {
+				const TraceQuery& query = Queries[i];
+
+				if (query.Shape.ShapeType == CollisionShapeType::Line)
+					batch.Handles.Add(world->AsyncLineTraceByChannel(EAsyncTraceType::Single, query.Start, query.End, (ECollisionChannel)query.Channel, GetQueryParams(query)));
+				else
+					batch.Handles.Add(world->AsyncSweepByChannel(EAsyncTraceType::Single, query.Start, query.End, query.Rotation, (ECollisionChannel)query.Channel, query.Shape, GetQueryParams(query)));
+			}
+
+			return handle;
+		}
+
+		int32 QueryTraceBatch(int32 Handle) {
+			PendingTraceBatch* batch = PendingTraceBatches.Find(Handle);
+
+			if (!batch)
+				return traceBatchExpired;
+
+			UWorld* world = batch->World.Get();
+			const int32 count = batch->Handles.Num();
+			int32 blockingHits = 0;
+
+			if (!world || GFrameCounter - batch->Frame > traceBatchLifetime) {
+				PendingTraceBatches.Remove(Handle);
+
+				return traceBatchExpired;
+			}
+
+			for (int32 i = 0; i < count; i++) {
+				if (!world->IsTraceHandleValid(batch->Handles[i], false)) {
+					PendingTraceBatches.Remove(Handle);
+
+					return traceBatchExpired;
+				}
+
+				FTraceDatum traceDatum;
+
+				if (!world->QueryTraceData(batch->Handles[i], traceDatum))
+					return traceBatchPending;
+			}
+
+			for (int32 i = 0; i < count; i++) {
+				FTraceDatum traceDatum;
+
+				if (world->QueryTraceData(batch->Handles[i], traceDatum) && traceDatum.OutHits.Num() > 0 && traceDatum.OutHits[0].bBlockingHit) {
+					batch->Results[i] = traceDatum.OutHits[0];
+					batch->Results[i].TraceStart = batch->Queries[i].Start;
+					batch->Results[i].TraceEnd = batch->Queries[i].End;
+
+					blockingHits++;
+				} else {
+					SetTraceMiss(batch->Queries[i], batch->Results[i]);
+				}
+			}
+
+			PendingTraceBatches.Remove(Handle);
+
+			return blockingHits;
+		}
+
+		int32 Subscribe(int32 TickGroup, void* Function, int32 Priority) {
+			if (TickGroup < UnrealCLR::OnWorldPrePhysicsTick || TickGroup > UnrealCLR::OnWorldPostUpdateTick)
+				return -1;
+
+			return UnrealCLR::Subscribe(TickGroup, Function, Priority);
+		}
+
+		void Unsubscribe(int32 Subscription) {
+			UnrealCLR::Unsubscribe(Subscription);
+		}
+
+		int32* GetSubscriberStates() {
+			return UnrealCLR::Shared::SubscriberStates;
+		}
+
+		bool SetFixedStep(int32 TickGroup, void* Function, float StepSize, int32 MaxSubsteps, void** Previous) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			*Previous = nullptr;
+
+			if (!context || TickGroup < UnrealCLR::OnWorldPrePhysicsTick || TickGroup > UnrealCLR::OnWorldPostUpdateTick || (Function && StepSize <= 0.0f))
 				return false;
+
+			UnrealCLR::FixedStep& fixedStep = context->FixedSteps[TickGroup - UnrealCLR::OnWorldPrePhysicsTick];
+
+			*Previous = fixedStep.Function;
+
+			fixedStep.Function = Function;
+			fixedStep.StepSize = StepSize;
+			fixedStep.MaxSubsteps = FMath::Max(MaxSubsteps, 0);
+			fixedStep.Accumulator = 0.0;
+			fixedStep.Substeps = 0;
+			fixedStep.Alpha = 0.0f;
+
+			return true;
+		}
+
+		float GetInterpolationAlpha(int32 TickGroup) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context || TickGroup < UnrealCLR::OnWorldPrePhysicsTick || TickGroup > UnrealCLR::OnWorldPostUpdateTick)
+				return 0.0f;
+
+			return context->FixedSteps[TickGroup - UnrealCLR::OnWorldPrePhysicsTick].Alpha;
+		}
+
+		void ReleaseTraceBatches(UWorld* World) {
+			for (auto batch = PendingTraceBatches.CreateIterator(); batch; ++batch) {
+				if (!batch.Value().World.IsValid() || batch.Value().World.Get() == World)
+					batch.RemoveCurrent();
+			}
+		}
+
+		void ExpireTraceBatches() {
+			// Batches that are never queried release their pointers to managed memory once the engine drops their results
+
+			for (auto batch = PendingTraceBatches.CreateIterator(); batch; ++batch) {
+				if (!batch.Value().World.IsValid() || GFrameCounter - batch.Value().Frame > traceBatchLifetime)
+					batch.RemoveCurrent();
+			}
+		}
+
+		static void AddToIndex(ActorIndex& Index, AActor* Actor) {
+			if (!IsValid(Actor))
+				return;
+
+			Index.Names.Add(Actor->GetFName(), Actor);
+			Index.Ids.Add(Actor->GetUniqueID(), Actor);
+
+			for (const FName& tag : Actor->Tags) {
+				Index.Tags.AddUnique(tag, Actor);
+			}
+		}
+
+		static void RemoveFromIndex(ActorIndex& Index, AActor* Actor) {
+			const TWeakObjectPtr<AActor> actor(Actor);
+			const TWeakObjectPtr<AActor>* entry = Index.Names.Find(Actor->GetFName());
+
+			if (entry && *entry == actor)
+				Index.Names.Remove(Actor->GetFName());
+
+			Index.Ids.Remove(Actor->GetUniqueID());
+
+			for (const FName& tag : Actor->Tags) {
+				Index.Tags.RemoveSingle(tag, actor);
+			}
+		}
+
+		static ActorIndex* GetActorIndex(UWorld* World) {
+			ActorIndex* index = ActorIndices.Find(World);
+
+			if (!index) {
+				index = &ActorIndices.Add(World);
+				index->Populated = false;
+
+				// Tags of spawned actors are set up by the spawning code after the notification, they are indexed on the next lookup
+
+				index->OnActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda([World](AActor* Actor) {
+					if (ActorIndex* index = ActorIndices.Find(World))
+						index->SpawnedActors.Add(Actor);
+				}));
+
+				#if ENGINE_MAJOR_VERSION >= 5
+					index->OnActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateLambda([World](AActor* Actor) {
+						if (ActorIndex* index = ActorIndices.Find(World))
+							RemoveFromIndex(*index, Actor);
+					}));
+				#endif
+
+				auto onLevelChanged = [World](ULevel* Level, UWorld* LevelWorld) {
+					ActorIndex* index = ActorIndices.Find(World);
+
+					if (index && LevelWorld == World)
+						index->Populated = false;
+				};
+
+				index->OnLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddLambda(onLevelChanged);
+				index->OnLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddLambda(onLevelChanged);
+			}
+
+			if (!index->Populated) {
+				index->Names.Reset();
+				index->Tags.Reset();
+				index->Ids.Reset();
+				index->SpawnedActors.Reset();
+
+				for (TActorIterator<AActor> currentActor(World); currentActor; ++currentActor) {
+					AddToIndex(*index, *currentActor);
+				}
+
+				index->Populated = true;
+			} else if (index->SpawnedActors.Num() > 0) {
+				for (const TWeakObjectPtr<AActor>& actor : index->SpawnedActors) {
+					AddToIndex(*index, actor.Get());
+				}
+
+				index->SpawnedActors.Reset();
+			}
+
+			return index;
+		}
+
+		// The engine doesn't notify about renamed actors and changed tags at runtime, entries are validated on lookup and misses fall back to the scan that indexes the found actor
+
+		AActor* FindActor(const char* Name) {
+			UWorld* world = UnrealCLR::Engine::World;
+			const FName name(UTF8_TO_TCHAR(Name));
+
+			if (!world || name.IsNone())
+				return nullptr;
+
+			ActorIndex* index = CVarActorIndex.GetValueOnGameThread() != 0 ? GetActorIndex(world) : nullptr;
+
+			if (index) {
+				if (const TWeakObjectPtr<AActor>* entry = index->Names.Find(name)) {
+					AActor* actor = entry->Get();
+
+					if (IsValid(actor) && actor->GetFName() == name)
+						return actor;
+
+					index->Names.Remove(name);
+				}
+			}
+
+			for (TActorIterator<AActor> currentActor(world); currentActor; ++currentActor) {
+				if (currentActor->GetFName() == name) {
+					if (index)
+						index->Names.Add(name, *currentActor);
+
+					return *currentActor;
+				}
+			}
+
+			return nullptr;
+		}
+
+		AActor* FindActorByTag(const char* Tag) {
+			UWorld* world = UnrealCLR::Engine::World;
+			const FName tag(UTF8_TO_TCHAR(Tag));
+
+			if (!world || tag.IsNone())
+				return nullptr;
+
+			ActorIndex* index = CVarActorIndex.GetValueOnGameThread() != 0 ? GetActorIndex(world) : nullptr;
+
+			if (index) {
+				for (auto entry = index->Tags.CreateKeyIterator(tag); entry; ++entry) {
+					AActor* actor = entry.Value().Get();
+
+					if (IsValid(actor) && actor->Tags.Contains(tag))
+						return actor;
+
+					entry.RemoveCurrent();
+				}
+			}
+
+			for (TActorIterator<AActor> currentActor(world); currentActor; ++currentActor) {
+				if (currentActor->Tags.Contains(tag)) {
+					if (index)
+						index->Tags.AddUnique(tag, *currentActor);
+
+					return *currentActor;
+				}
+			}
+
+			return nullptr;
+		}
+
+		AActor* FindActorByID(uint32 Id) {
+			UWorld* world = UnrealCLR::Engine::World;
+
+			if (!world)
+				return nullptr;
+
+			if (CVarActorIndex.GetValueOnGameThread() != 0) {
+				ActorIndex* index = GetActorIndex(world);
+
+				if (const TWeakObjectPtr<AActor>* entry = index->Ids.Find(Id)) {
+					AActor* actor = entry->Get();
+
+					if (IsValid(actor) && actor->GetUniqueID() == Id)
+						return actor;
+
+					index->Ids.Remove(Id);
+				}
+
+				return nullptr;
+			}
+
+			for (TActorIterator<AActor> currentActor(world); currentActor; ++currentActor) {
+				if (currentActor->GetUniqueID() == Id)
+					return *currentActor;
+			}
+
+			return nullptr;
+		}
+
+		void ReleaseActorIndex(UWorld* World) {
+			ActorIndex* index = ActorIndices.Find(World);
+
+			if (!index)
+				return;
+
+			World->RemoveOnActorSpawnedHandler(index->OnActorSpawnedHandle);
+
+			#if ENGINE_MAJOR_VERSION >= 5
+				World->RemoveOnActorDestroyededHandler(index->OnActorDestroyedHandle);
 			#endif
+
+			FWorldDelegates::LevelAddedToWorld.Remove(index->OnLevelAddedHandle);
+			FWorldDelegates::LevelRemovedFromWorld.Remove(index->OnLevelRemovedHandle);
+
+			ActorIndices.Remove(World);
 		}
+	}
 
-		void GetProjectDirectory(char* Directory) {
-			const char* directory = TCHAR_TO_UTF8(*FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
+	namespace TickFunction {
+		static int32 SystemTickFunctionsHandle;
 
-			UnrealCLR::Utility::Strcpy(Directory, directory, UnrealCLR::Utility::Strlen(directory));
+		static UnrealCLR::SystemTickFunction* Find(int32 Handle) {
+			for (const TUniquePtr<UnrealCLR::WorldContext>& context : UnrealCLR::WorldContexts) {
+				TUniquePtr<UnrealCLR::SystemTickFunction>* tickFunction = context->SystemTickFunctions.Find(Handle);
+
+				if (tickFunction)
+					return tickFunction->Get();
+			}
+
+			return nullptr;
 		}
 
-		void GetDefaultLanguage(char* Language) {
-			const char* language = TCHAR_TO_UTF8(*FGenericPlatformMisc::GetDefaultLanguage());
+		int32 Create(int32 TickGroup, void* Function, float Interval) {
+			static constexpr ETickingGroup tickGroups[] = { TG_PrePhysics, TG_DuringPhysics, TG_PostPhysics, TG_PostUpdateWork };
+			static constexpr float staggerRatio = 0.618034f;
+
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context || !Function || TickGroup < UnrealCLR::OnWorldPrePhysicsTick || TickGroup > UnrealCLR::OnWorldPostUpdateTick)
+				return -1;
+
+			const int32 handle = SystemTickFunctionsHandle++;
+			UnrealCLR::SystemTickFunction* tickFunction = context->SystemTickFunctions.Add(handle, MakeUnique<UnrealCLR::SystemTickFunction>()).Get();
+
+			tickFunction->Context = context;
+			tickFunction->Function = Function;
+			tickFunction->Event = TickGroup;
+			tickFunction->bCanEverTick = true;
+			tickFunction->bTickEvenWhenPaused = false;
+			tickFunction->bAllowTickOnDedicatedServer = true;
+			tickFunction->bRunOnAnyThread = false;
+			tickFunction->TickGroup = tickGroups[TickGroup - UnrealCLR::OnWorldPrePhysicsTick];
+			tickFunction->TickInterval = FMath::Max(Interval, 0.0f);
+			tickFunction->PendingStart = false;
+
+			if (tickFunction->TickInterval > 0.0f) {
+				const float phase = FMath::Frac(context->StaggeredSystemTickFunctions++ * staggerRatio) * tickFunction->TickInterval;
+
+				if (phase > 0.0f) {
+					tickFunction->StartTime = context->World->GetTimeSeconds() + phase;
+					tickFunction->PendingStart = true;
+
+					context->PendingSystemTickFunctions++;
+				}
+			}
+
+			tickFunction->bStartWithTickEnabled = !tickFunction->PendingStart;
+			tickFunction->RegisterTickFunction(context->World->PersistentLevel);
 
-			UnrealCLR::Utility::Strcpy(Language, language, UnrealCLR::Utility::Strlen(language));
+			return handle;
 		}
 
-		void GetProjectName(char* ProjectName) {
-			const char* projectName = TCHAR_TO_UTF8(FApp::GetProjectName());
+		void Destroy(int32 Handle) {
+			for (const TUniquePtr<UnrealCLR::WorldContext>& context : UnrealCLR::WorldContexts) {
+				TUniquePtr<UnrealCLR::SystemTickFunction> tickFunction;
 
-			UnrealCLR::Utility::Strcpy(ProjectName, projectName, UnrealCLR::Utility::Strlen(projectName));
+				if (context->SystemTickFunctions.RemoveAndCopyValue(Handle, tickFunction)) {
+					if (tickFunction->PendingStart)
+						context->PendingSystemTickFunctions--;
+
+					tickFunction->UnRegisterTickFunction();
+
+					return;
+				}
+			}
 		}
 
-		float GetVolumeMultiplier() {
-			return FApp::GetVolumeMultiplier();
+		void SetEnabled(int32 Handle, bool Value) {
+			UnrealCLR::SystemTickFunction* tickFunction = Find(Handle);
+
+			if (!tickFunction)
+				return;
+
+			if (tickFunction->PendingStart) {
+				tickFunction->PendingStart = false;
+				tickFunction->Context->PendingSystemTickFunctions--;
+			}
+
+			tickFunction->SetTickFunctionEnable(Value);
 		}
 
-		void SetProjectName(const char* ProjectName) {
-			FApp::SetProjectName(UTF8_TO_TCHAR(ProjectName));
+		void SetInterval(int32 Handle, float Value) {
+			UnrealCLR::SystemTickFunction* tickFunction = Find(Handle);
+
+			if (tickFunction)
+				tickFunction->UpdateTickIntervalAndCoolDown(FMath::Max(Value, 0.0f));
 		}
 
-		void SetVolumeMultiplier(float Value) {
-			FApp::SetVolumeMultiplier(Value);
+		void AddPrerequisite(int32 Handle, UObject* Prerequisite) {
+			UnrealCLR::SystemTickFunction* tickFunction = Find(Handle);
+
+			if (!tickFunction || !Prerequisite)
+				return;
+
+			if (AActor* actor = Cast<AActor>(Prerequisite))
+				tickFunction->AddPrerequisite(actor, actor->PrimaryActorTick);
+			else if (UActorComponent* component = Cast<UActorComponent>(Prerequisite))
+				tickFunction->AddPrerequisite(component, component->PrimaryComponentTick);
+		}
+
+		void AddTickFunctionPrerequisite(int32 Handle, int32 Prerequisite) {
+			UnrealCLR::SystemTickFunction* tickFunction = Find(Handle);
+			UnrealCLR::SystemTickFunction* prerequisite = Find(Prerequisite);
+
+			if (tickFunction && prerequisite && tickFunction != prerequisite)
+				tickFunction->AddPrerequisite(prerequisite->Context->Manager, *prerequisite);
+		}
+	}
+
+	namespace Timer {
+		void SetHandler(void* Function) {
+			UnrealCLR::Shared::TimerHandler = Function;
+		}
+
+		int32 Schedule(float Delay, float Period, int32 Id) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context)
+				return -1;
+
+			return context->Timers.Schedule(FMath::Max(Delay, 0.0f), FMath::Max(Period, 0.0f), Id);
+		}
+
+		bool Cancel(int32 Handle) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			return context && context->Timers.Cancel(Handle);
+		}
+
+		bool IsScheduled(int32 Handle) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			return context && context->Timers.IsScheduled(Handle);
+		}
+
+		float GetRemaining(int32 Handle) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context)
+				return 0.0f;
+
+			return (float)context->Timers.GetRemaining(Handle);
+		}
+
+		int32 GetCount() {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context)
+				return 0;
+
+			return context->Timers.Count;
+		}
+	}
+
+	namespace FunctionHandle {
+		struct ResolvedFunction {
+			TWeakObjectPtr<UFunction> Function;
+			uint8* Parameters;
+		};
+
+		static TMap<int32, ResolvedFunction> ResolvedFunctions;
+		static int32 ResolvedFunctionsHandle;
+
+		int32 Resolve(UObject* Object, const char* Name, int32* ParametersSize) {
+			if (!IsValid(Object))
+				return -1;
+
+			UFunction* function = Object->FindFunction(FName(UTF8_TO_TCHAR(Name)));
+
+			if (!function) {
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Function \"%s\" is not found in \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), UTF8_TO_TCHAR(Name), *Object->GetClass()->GetName());
+
+				return -1;
+			}
+
+			for (TFieldIterator<FProperty> currentProperty(function); currentProperty && currentProperty->HasAnyPropertyFlags(CPF_Parm); ++currentProperty) {
+				FProperty* property = *currentProperty;
+
+				if (!property->HasAnyPropertyFlags(CPF_IsPlainOldData) && !CastField<FObjectProperty>(property)) {
+					UE_LOG(LogUnrealCLR, Error, TEXT("%s: Parameter \"%s\" of function \"%s\" is not blittable"), ANSI_TO_TCHAR(__FUNCTION__), *property->GetName(), *function->GetName());
+
+					return -1;
+				}
+			}
+
+			const int32 handle = ResolvedFunctionsHandle++;
+			ResolvedFunction& resolvedFunction = ResolvedFunctions.Add(handle);
+
+			resolvedFunction.Function = function;
+			resolvedFunction.Parameters = (uint8*)FMemory::Malloc(FMath::Max<int32>(function->ParmsSize, 1), function->GetMinAlignment());
+
+			FMemory::Memzero(resolvedFunction.Parameters, FMath::Max<int32>(function->ParmsSize, 1));
+
+			*ParametersSize = function->ParmsSize;
+
+			return handle;
+		}
+
+		void* GetParameters(int32 Handle) {
+			ResolvedFunction* resolvedFunction = ResolvedFunctions.Find(Handle);
+
+			return resolvedFunction ? resolvedFunction->Parameters : nullptr;
+		}
+
+		int32 GetParameterOffset(int32 Handle, const char* Name) {
+			ResolvedFunction* resolvedFunction = ResolvedFunctions.Find(Handle);
+			UFunction* function = resolvedFunction ? resolvedFunction->Function.Get() : nullptr;
+
+			if (!function)
+				return -1;
+
+			FName name(UTF8_TO_TCHAR(Name));
+
+			for (TFieldIterator<FProperty> currentProperty(function); currentProperty && currentProperty->HasAnyPropertyFlags(CPF_Parm); ++currentProperty) {
+				FProperty* property = *currentProperty;
+
+				if (property->GetFName() == name)
+					return property->GetOffset_ForUFunction();
+			}
+
+			return -1;
+		}
+
+		bool Invoke(int32 Handle, UObject* Object) {
+			ResolvedFunction* resolvedFunction = ResolvedFunctions.Find(Handle);
+			UFunction* function = resolvedFunction ? resolvedFunction->Function.Get() : nullptr;
+
+			if (!function || !IsValid(Object) || !Object->IsA(function->GetOuterUClass()))
+				return false;
+
+			Object->ProcessEvent(function, resolvedFunction->Parameters);
+
+			return true;
+		}
+
+		void Release(int32 Handle) {
+			ResolvedFunction resolvedFunction;
+
+			if (ResolvedFunctions.RemoveAndCopyValue(Handle, resolvedFunction))
+				FMemory::Free(resolvedFunction.Parameters);
+		}
+
+		void ReleaseAll() {
+			for (const TPair<int32, ResolvedFunction>& resolvedFunction : ResolvedFunctions) {
+				FMemory::Free(resolvedFunction.Value.Parameters);
+			}
+
+			ResolvedFunctions.Empty();
+		}
+	}
+
+	namespace ActorQuery {
+		struct Query {
+			TWeakObjectPtr<UWorld> World;
+			TWeakObjectPtr<UClass> ActorClass;
+			TWeakObjectPtr<UClass> ComponentClass;
+			TArray<FName> Tags;
+			FBox Bounds;
+			bool UseBounds;
+			bool Incremental;
+			bool Populated;
+			TArray<AActor*> Actors;
+			TArray<TWeakObjectPtr<AActor>> Entries;
+			TMap<TWeakObjectPtr<AActor>, int32> Indices;
+			TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+			TArray<TWeakObjectPtr<AActor>> DestroyedActors;
+			FDelegateHandle OnActorSpawnedHandle;
+			FDelegateHandle OnActorDestroyedHandle;
+			FDelegateHandle OnLevelAddedHandle;
+			FDelegateHandle OnLevelRemovedHandle;
+		};
+
+		static TMap<int32, Query> Queries;
+		static int32 QueriesHandle;
+
+		static UClass* FindClass(const char* Name) {
+			const FString name(UTF8_TO_TCHAR(Name));
+
+			if (name.StartsWith(TEXT("/")))
+				return LoadObject<UClass>(nullptr, *name);
+
+			#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
+				return UClass::TryFindTypeSlow<UClass>(name);
+			#else
+				return FindObject<UClass>(ANY_PACKAGE, *name);
+			#endif
+		}
+
+		static bool Matches(const Query& Query, AActor* Actor) {
+			if (!IsValid(Actor))
+				return false;
+
+			UClass* actorClass = Query.ActorClass.Get();
+			UClass* componentClass = Query.ComponentClass.Get();
+
+			if (actorClass && !Actor->IsA(actorClass))
+				return false;
+
+			for (const FName& tag : Query.Tags) {
+				if (!Actor->Tags.Contains(tag))
+					return false;
+			}
+
+			if (componentClass && !Actor->FindComponentByClass(componentClass))
+				return false;
+
+			return !Query.UseBounds || Query.Bounds.IsInsideOrOn(Actor->GetActorLocation());
+		}
+
+		static void Add(Query& Query, AActor* Actor) {
+			if (Query.Indices.Contains(Actor))
+				return;
+
+			Query.Indices.Add(Actor, Query.Actors.Add(Actor));
+			Query.Entries.Add(Actor);
+		}
+
+		static void Remove(Query& Query, TWeakObjectPtr<AActor> Actor) {
+			int32 index = INDEX_NONE;
+
+			if (!Query.Indices.RemoveAndCopyValue(Actor, index))
+				return;
+
+			Query.Actors.RemoveAtSwap(index, 1, false);
+			Query.Entries.RemoveAtSwap(index, 1, false);
+
+			if (index < Query.Entries.Num())
+				Query.Indices[Query.Entries[index]] = index;
+		}
+
+		static void Populate(Query& Query, UWorld* World) {
+			UClass* actorClass = Query.ActorClass.Get();
+
+			Query.Actors.Reset();
+			Query.Entries.Reset();
+			Query.Indices.Reset();
+			Query.SpawnedActors.Reset();
+			Query.DestroyedActors.Reset();
+
+			// The iterator walks the object hash of the class instead of all actors when the class is specified
+
+			for (TActorIterator<AActor> currentActor(World, actorClass ? actorClass : AActor::StaticClass()); currentActor; ++currentActor) {
+				if (Matches(Query, *currentActor))
+					Add(Query, *currentActor);
+			}
+
+			Query.Populated = Query.Incremental;
+		}
+
+		static void Unbind(Query& Query) {
+			if (UWorld* world = Query.World.Get()) {
+				if (Query.OnActorSpawnedHandle.IsValid())
+					world->RemoveOnActorSpawnedHandler(Query.OnActorSpawnedHandle);
+
+				// The name of the function is spelled this way by the engine
+
+				#if ENGINE_MAJOR_VERSION >= 5
+					if (Query.OnActorDestroyedHandle.IsValid())
+						world->RemoveOnActorDestroyededHandler(Query.OnActorDestroyedHandle);
+				#endif
+			}
+
+			FWorldDelegates::LevelAddedToWorld.Remove(Query.OnLevelAddedHandle);
+			FWorldDelegates::LevelRemovedFromWorld.Remove(Query.OnLevelRemovedHandle);
+		}
+
+		int32 Create(const ActorQueryDescription* Description) {
+			UWorld* world = UnrealCLR::Engine::World;
+
+			if (!world)
+				return -1;
+
+			UClass* actorClass = Description->ActorClass ? FindClass(Description->ActorClass) : nullptr;
+			UClass* componentClass = Description->ComponentClass ? FindClass(Description->ComponentClass) : nullptr;
+
+			if ((Description->ActorClass && (!actorClass || !actorClass->IsChildOf(AActor::StaticClass()))) || (Description->ComponentClass && (!componentClass || !componentClass->IsChildOf(UActorComponent::StaticClass())))) {
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Class \"%s\" is not found"), ANSI_TO_TCHAR(__FUNCTION__), UTF8_TO_TCHAR(Description->ActorClass && !actorClass ? Description->ActorClass : Description->ComponentClass));
+
+				return -1;
+			}
+
+			if (Description->Incremental && Description->UseBounds) {
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Bounds can't be used with incremental queries since actors move without notifications"), ANSI_TO_TCHAR(__FUNCTION__));
+
+				return -1;
+			}
+
+			const int32 handle = QueriesHandle++;
+			Query& query = Queries.Add(handle);
+
+			query.World = world;
+			query.ActorClass = actorClass;
+			query.ComponentClass = componentClass;
+			query.Bounds = FBox(Description->BoundsMin, Description->BoundsMax);
+			query.UseBounds = Description->UseBounds;
+			query.Incremental = Description->Incremental;
+			query.Populated = false;
+
+			for (int32 i = 0; i < Description->TagsCount; i++) {
+				query.Tags.Add(FName(UTF8_TO_TCHAR(Description->Tags[i])));
+			}
+
+			if (query.Incremental) {
+				// Spawned actors are matched on the next update, after their components and tags are set up by the spawning code
+
+				query.OnActorSpawnedHandle = world->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda([handle](AActor* Actor) {
+					if (Query* query = Queries.Find(handle))
+						query->SpawnedActors.Add(Actor);
+				}));
+
+				#if ENGINE_MAJOR_VERSION >= 5
+					query.OnActorDestroyedHandle = world->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateLambda([handle](AActor* Actor) {
+						if (Query* query = Queries.Find(handle))
+							query->DestroyedActors.Add(Actor);
+					}));
+				#endif
+
+				// Actors of streamed levels are not spawned, the snapshot is populated again when levels are added or removed
+
+				auto onLevelChanged = [handle](ULevel* Level, UWorld* World) {
+					Query* query = Queries.Find(handle);
+
+					if (query && query->World == World)
+						query->Populated = false;
+				};
+
+				query.OnLevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddLambda(onLevelChanged);
+				query.OnLevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddLambda(onLevelChanged);
+			}
+
+			return handle;
+		}
+
+		AActor** Update(int32 Handle, int32* Count) {
+			Query* query = Queries.Find(Handle);
+			UWorld* world = query ? query->World.Get() : nullptr;
+
+			*Count = 0;
+
+			if (!world)
+				return nullptr;
+
+			if (!query->Populated) {
+				Populate(*query, world);
+			} else {
+				for (const TWeakObjectPtr<AActor>& actor : query->DestroyedActors) {
+					Remove(*query, actor);
+				}
+
+				for (const TWeakObjectPtr<AActor>& actor : query->SpawnedActors) {
+					if (Matches(*query, actor.Get()))
+						Add(*query, actor.Get());
+				}
+
+				query->SpawnedActors.Reset();
+				query->DestroyedActors.Reset();
+
+				#if ENGINE_MAJOR_VERSION == 4
+					// Destruction is not broadcasted by the world, stale entries are removed by the validity of weak pointers
+
+					for (int32 i = query->Entries.Num() - 1; i >= 0; i--) {
+						if (!query->Entries[i].IsValid())
+							Remove(*query, query->Entries[i]);
+					}
+				#endif
+			}
+
+			*Count = query->Actors.Num();
+
+			return query->Actors.GetData();
+		}
+
+		void Release(int32 Handle) {
+			Query query;
+
+			if (Queries.RemoveAndCopyValue(Handle, query))
+				Unbind(query);
+		}
+
+		void ReleaseAll(UWorld* World) {
+			for (auto query = Queries.CreateIterator(); query; ++query) {
+				if (query.Value().World.IsStale() || query.Value().World == World) {
+					Unbind(query.Value());
+					query.RemoveCurrent();
+				}
+			}
+		}
+	}
+
+	namespace Spline {
+		static FORCEINLINE float GetInputKey(const USplineComponent* SplineComponent, float Key, SplineSampleMode Mode) {
+			const float duration = SplineComponent->Duration;
+
+			if (Mode == SplineSampleMode::Time) {
+				if (duration == 0.0f)
+					return 0.0f;
+
+				return Key / duration * SplineComponent->GetNumberOfSplineSegments();
+			}
+
+			float distance = Key;
+
+			if (Mode == SplineSampleMode::TimeWithConstantVelocity) {
+				if (duration == 0.0f)
+					return 0.0f;
+
+				distance = Key / duration * SplineComponent->GetSplineLength();
+			}
+
+			// The distance is mapped to the input key once and shared by all requested values instead of once per value
+
+			return SplineComponent->SplineCurves.ReparamTable.Eval(distance, 0.0f);
+		}
+
+		bool Sample(UObject* SplineComponent, const float* Keys, int32 Count, SplineSampleMode Mode, int32 CoordinateSpace, Vector3* Locations, Vector3* Tangents, Quaternion* Rotations, Transform* Transforms) {
+			const USplineComponent* splineComponent = Cast<USplineComponent>(SplineComponent);
+
+			if (!splineComponent)
+				return false;
+
+			const ESplineCoordinateSpace::Type coordinateSpace = (ESplineCoordinateSpace::Type)CoordinateSpace;
+
+			for (int32 i = 0; i < Count; i++) {
+				const float inputKey = GetInputKey(splineComponent, Keys[i], Mode);
+
+				if (Locations)
+					Locations[i] = splineComponent->GetLocationAtSplineInputKey(inputKey, coordinateSpace);
+
+				if (Tangents)
+					Tangents[i] = splineComponent->GetTangentAtSplineInputKey(inputKey, coordinateSpace);
+
+				if (Rotations)
+					Rotations[i] = splineComponent->GetQuaternionAtSplineInputKey(inputKey, coordinateSpace);
+
+				if (Transforms)
+					Transforms[i] = splineComponent->GetTransformAtSplineInputKey(inputKey, coordinateSpace, true);
+			}
+
+			return true;
+		}
+
+		bool SetPoints(UObject* SplineComponent, const Vector3* Locations, const Vector3* Tangents, int32 Count, int32 CoordinateSpace) {
+			USplineComponent* splineComponent = Cast<USplineComponent>(SplineComponent);
+
+			if (!splineComponent)
+				return false;
+
+			const ESplineCoordinateSpace::Type coordinateSpace = (ESplineCoordinateSpace::Type)CoordinateSpace;
+			TArray<FVector> points;
+
+			points.Reserve(Count);
+
+			for (int32 i = 0; i < Count; i++) {
+				points.Add(Locations[i]);
+			}
+
+			splineComponent->SetSplinePoints(points, coordinateSpace, false);
+
+			if (Tangents) {
+				for (int32 i = 0; i < Count; i++) {
+					splineComponent->SetTangentAtSplinePoint(i, Tangents[i], coordinateSpace, false);
+				}
+			}
+
+			splineComponent->UpdateSpline();
+
+			return true;
+		}
+
+		bool UpdatePoints(UObject* SplineComponent, const int32* Indices, const Vector3* Locations, const Vector3* Tangents, int32 Count, int32 CoordinateSpace) {
+			USplineComponent* splineComponent = Cast<USplineComponent>(SplineComponent);
+
+			if (!splineComponent)
+				return false;
+
+			const ESplineCoordinateSpace::Type coordinateSpace = (ESplineCoordinateSpace::Type)CoordinateSpace;
+			const int32 pointsCount = splineComponent->GetNumberOfSplinePoints();
+
+			for (int32 i = 0; i < Count; i++) {
+				if (Indices[i] < 0 || Indices[i] >= pointsCount)
+					return false;
+			}
+
+			for (int32 i = 0; i < Count; i++) {
+				splineComponent->SetLocationAtSplinePoint(Indices[i], Locations[i], coordinateSpace, false);
+
+				if (Tangents)
+					splineComponent->SetTangentAtSplinePoint(Indices[i], Tangents[i], coordinateSpace, false);
+			}
+
+			splineComponent->UpdateSpline();
+
+			return true;
+		}
+	}
+
+	namespace AnimationBinding {
+		struct Binding {
+			TArray<FName> Curves;
+			TArray<FName> Parameters;
+			TMap<TWeakObjectPtr<UClass>, TArray<FProperty*>> Properties;
+		};
+
+		static TMap<int32, Binding> Bindings;
+		static int32 BindingsHandle;
+
+		static UAnimInstance* GetAnimInstance(UObject* Object) {
+			if (USkeletalMeshComponent* skeletalMeshComponent = Cast<USkeletalMeshComponent>(Object))
+				return skeletalMeshComponent->GetAnimInstance();
+
+			return Cast<UAnimInstance>(Object);
+		}
+
+		static const TArray<FProperty*>& GetProperties(Binding& Binding, UClass* Class) {
+			TArray<FProperty*>* properties = Binding.Properties.Find(Class);
+
+			if (properties)
+				return *properties;
+
+			// Properties are resolved once per class of animation blueprints, parameters that are not numeric or boolean are skipped
+
+			properties = &Binding.Properties.Add(Class);
+			properties->Reserve(Binding.Parameters.Num());
+
+			for (const FName& parameter : Binding.Parameters) {
+				FProperty* property = Class->FindPropertyByName(parameter);
+
+				properties->Add(CastField<FNumericProperty>(property) || CastField<FBoolProperty>(property) ? property : nullptr);
+			}
+
+			return *properties;
+		}
+
+		static FORCEINLINE void WaitForEvaluation(UAnimInstance* AnimInstance) {
+			// Curves and parameters are accessed by worker threads during the parallel evaluation, the running task is completed on the calling thread before any access
+
+			USkeletalMeshComponent* skeletalMeshComponent = AnimInstance->GetSkelMeshComponent();
+
+			if (skeletalMeshComponent && skeletalMeshComponent->IsRunningParallelEvaluation())
+				skeletalMeshComponent->HandleExistingParallelEvaluationTask(true, true);
+		}
+
+		int32 Create(const char* const* Curves, int32 CurvesCount, const char* const* Parameters, int32 ParametersCount) {
+			const int32 handle = BindingsHandle++;
+			Binding& binding = Bindings.Add(handle);
+
+			for (int32 i = 0; i < CurvesCount; i++) {
+				binding.Curves.Add(FName(UTF8_TO_TCHAR(Curves[i])));
+			}
+
+			for (int32 i = 0; i < ParametersCount; i++) {
+				binding.Parameters.Add(FName(UTF8_TO_TCHAR(Parameters[i])));
+			}
+
+			return handle;
+		}
+
+		int32 Read(int32 Handle, UObject** Instances, int32 Count, float* Curves, float* Parameters) {
+			Binding* binding = Bindings.Find(Handle);
+
+			if (!binding)
+				return -1;
+
+			const int32 curvesCount = binding->Curves.Num();
+			const int32 parametersCount = binding->Parameters.Num();
+			int32 read = 0;
+
+			for (int32 i = 0; i < Count; i++) {
+				UAnimInstance* animInstance = IsValid(Instances[i]) ? GetAnimInstance(Instances[i]) : nullptr;
+
+				if (!animInstance) {
+					for (int32 j = 0; j < curvesCount; j++) {
+						Curves[j * Count + i] = 0.0f;
+					}
+
+					for (int32 j = 0; j < parametersCount; j++) {
+						Parameters[j * Count + i] = 0.0f;
+					}
+
+					continue;
+				}
+
+				WaitForEvaluation(animInstance);
+
+				for (int32 j = 0; j < curvesCount; j++) {
+					Curves[j * Count + i] = animInstance->GetCurveValue(binding->Curves[j]);
+				}
+
+				if (parametersCount > 0) {
+					const TArray<FProperty*>& properties = GetProperties(*binding, animInstance->GetClass());
+
+					for (int32 j = 0; j < parametersCount; j++) {
+						const FProperty* property = properties[j];
+						const void* value = property ? property->ContainerPtrToValuePtr<void>(animInstance) : nullptr;
+
+						if (!value)
+							Parameters[j * Count + i] = 0.0f;
+						else if (const FBoolProperty* boolProperty = CastField<FBoolProperty>(property))
+							Parameters[j * Count + i] = boolProperty->GetPropertyValue(value) ? 1.0f : 0.0f;
+						else if (CastFieldChecked<FNumericProperty>(property)->IsFloatingPoint())
+							Parameters[j * Count + i] = static_cast<float>(CastFieldChecked<FNumericProperty>(property)->GetFloatingPointPropertyValue(value));
+						else
+							Parameters[j * Count + i] = static_cast<float>(CastFieldChecked<FNumericProperty>(property)->GetSignedIntPropertyValue(value));
+					}
+				}
+
+				read++;
+			}
+
+			return read;
+		}
+
+		int32 Write(int32 Handle, UObject** Instances, int32 Count, const float* Parameters) {
+			Binding* binding = Bindings.Find(Handle);
+
+			if (!binding)
+				return -1;
+
+			const int32 parametersCount = binding->Parameters.Num();
+			int32 written = 0;
+
+			for (int32 i = 0; i < Count; i++) {
+				UAnimInstance* animInstance = IsValid(Instances[i]) ? GetAnimInstance(Instances[i]) : nullptr;
+
+				if (!animInstance)
+					continue;
+
+				const TArray<FProperty*>& properties = GetProperties(*binding, animInstance->GetClass());
+
+				WaitForEvaluation(animInstance);
+
+				for (int32 j = 0; j < parametersCount; j++) {
+					const FProperty* property = properties[j];
+
+					if (!property)
+						continue;
+
+					void* value = property->ContainerPtrToValuePtr<void>(animInstance);
+					const float parameter = Parameters[j * Count + i];
+
+					if (const FBoolProperty* boolProperty = CastField<FBoolProperty>(property))
+						boolProperty->SetPropertyValue(value, parameter != 0.0f);
+					else if (CastFieldChecked<FNumericProperty>(property)->IsFloatingPoint())
+						CastFieldChecked<FNumericProperty>(property)->SetFloatingPointPropertyValue(value, parameter);
+					else
+						CastFieldChecked<FNumericProperty>(property)->SetIntPropertyValue(value, static_cast<int64>(FMath::RoundToInt(parameter)));
+				}
+
+				written++;
+			}
+
+			return written;
+		}
+
+		void Release(int32 Handle) {
+			Bindings.Remove(Handle);
+		}
+
+		void ReleaseAll() {
+			Bindings.Empty();
+		}
+	}
+
+	namespace Input {
+		static int32 Bind(const char* Name, bool Axis) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context)
+				return -1;
+
+			UnrealCLR::InputBinding& binding = context->InputBindings.AddDefaulted_GetRef();
+
+			binding.Name = FName(UTF8_TO_TCHAR(Name));
+			binding.Id = context->InputBindingsHandle++;
+			binding.Axis = Axis;
+
+			for (const TPair<TWeakObjectPtr<APlayerController>, UnrealCLR::InputTarget>& target : context->InputTargets) {
+				context->AddInputBinding(target.Value, binding);
+			}
+
+			return binding.Id;
+		}
+
+		void SetHandler(void* Function) {
+			UnrealCLR::Shared::InputHandler = Function;
+		}
+
+		bool SetTickGroup(int32 TickGroup) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context || TickGroup < UnrealCLR::OnWorldPrePhysicsTick || TickGroup > UnrealCLR::OnWorldPostUpdateTick)
+				return false;
+
+			context->InputTickGroup = TickGroup;
+
+			return true;
+		}
+
+		int32 BindAction(const char* Name) {
+			return Bind(Name, false);
+		}
+
+		int32 BindAxis(const char* Name) {
+			return Bind(Name, true);
+		}
+
+		bool Unbind(int32 Binding) {
+			UnrealCLR::WorldContext* context = UnrealCLR::Engine::Context;
+
+			if (!context || context->InputBindings.RemoveAll([Binding](const UnrealCLR::InputBinding& Value) { return Value.Id == Binding; }) == 0)
+				return false;
+
+			context->RebuildInputBindings();
+
+			return true;
+		}
+	}
+
+	namespace TexturePixels {
+		static FTexturePlatformData* GetPlatformData(UTexture2D* Texture) {
+			#if ENGINE_MAJOR_VERSION >= 5
+				return Texture->GetPlatformData();
+			#else
+				return Texture->PlatformData;
+			#endif
+		}
+
+		void SetHandler(void* Function) {
+			UnrealCLR::Shared::TextureUploadHandler = Function;
+		}
+
+		uint8* Lock(UObject* Texture, int32 Mip, int32* Width, int32* Height, int32* Size) {
+			UTexture2D* texture = Cast<UTexture2D>(Texture);
+			FTexturePlatformData* platformData = texture ? GetPlatformData(texture) : nullptr;
+
+			*Width = 0;
+			*Height = 0;
+			*Size = 0;
+
+			if (!platformData || !platformData->Mips.IsValidIndex(Mip) || platformData->Mips[Mip].BulkData.IsLocked())
+				return nullptr;
+
+			FTexture2DMipMap& mip = platformData->Mips[Mip];
+			uint8* data = static_cast<uint8*>(mip.BulkData.Lock(LOCK_READ_WRITE));
+			const int64 size = mip.BulkData.GetBulkDataSize();
+
+			// Mips of cooked textures are uploaded to the GPU and are not kept in memory
+
+			if (!data || size == 0) {
+				mip.BulkData.Unlock();
+
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Mip %d of texture \"%s\" is not resident in memory"), ANSI_TO_TCHAR(__FUNCTION__), Mip, *texture->GetName());
+
+				return nullptr;
+			}
+
+			*Width = mip.SizeX;
+			*Height = mip.SizeY;
+			*Size = static_cast<int32>(size);
+
+			return data;
+		}
+
+		bool Unlock(UObject* Texture, int32 Mip, bool UpdateResource) {
+			UTexture2D* texture = Cast<UTexture2D>(Texture);
+			FTexturePlatformData* platformData = texture ? GetPlatformData(texture) : nullptr;
+
+			if (!platformData || !platformData->Mips.IsValidIndex(Mip) || !platformData->Mips[Mip].BulkData.IsLocked())
+				return false;
+
+			platformData->Mips[Mip].BulkData.Unlock();
+
+			if (UpdateResource)
+				texture->UpdateResource();
+
+			return true;
+		}
+
+		bool UpdateRegions(UObject* Texture, int32 Mip, const TextureRegion* Regions, int32 RegionsCount, int32 Pitch, int32 BytesPerPixel, uint8* Data, int32 Id) {
+			UTexture2D* texture = Cast<UTexture2D>(Texture);
+
+			#if ENGINE_MAJOR_VERSION >= 5
+				const bool hasResource = texture && texture->GetResource();
+			#else
+				const bool hasResource = texture && texture->Resource;
+			#endif
+
+			if (!hasResource || RegionsCount <= 0 || Mip < 0 || Mip >= texture->GetNumMips())
+				return false;
+
+			// Only descriptions of regions are copied, pixels are read by the rendering thread directly from the pinned managed memory
+
+			FUpdateTextureRegion2D* regions = new FUpdateTextureRegion2D[RegionsCount];
+
+			for (int32 i = 0; i < RegionsCount; i++) {
+				const TextureRegion& region = Regions[i];
+
+				regions[i] = FUpdateTextureRegion2D(region.DestinationX, region.DestinationY, region.SourceX, region.SourceY, region.Width, region.Height);
+			}
+
+			UnrealCLR::TextureUploadQueue.Pending++;
+
+			texture->UpdateTextureRegions(Mip, RegionsCount, regions, Pitch, BytesPerPixel, Data, [Id](uint8* Data, const FUpdateTextureRegion2D* Regions) {
+				delete[] Regions;
+
+				UnrealCLR::TextureUploadQueue.Completed.Enqueue(Id);
+			});
+
+			return true;
+		}
+	}
+
+	namespace Memory {
+		void* GetFrameArena() {
+			return &UnrealCLR::FrameArena;
+		}
+
+		void* GetMutationQueue() {
+			return &UnrealCLR::Mutations;
+		}
+
+		void SetMutationHandler(void* Function) {
+			UnrealCLR::Shared::MutationHandler = Function;
+		}
+
+		void* GetDebugDraw() {
+			return &UnrealCLR::DebugDrawBuffers;
 		}
 
-		void RequestExit(bool Force) {
-			FGenericPlatformMisc::RequestExit(Force);
+		bool IsInGameThread() {
+			return ::IsInGameThread();
 		}
 	}
 }
@@ -28,7 +28,20 @@
 #include "../../Dependencies/CoreCLR/includes/hostfxr.h"
 // @third party code - END CoreCLR
 
+#include "Algo/BinarySearch.h"
+#include "Animation/AnimInstance.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Components/InputComponent.h"
+#include "Components/LineBatchComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SplineComponent.h"
+#include "DrawDebugHelpers.h"
 #include "EngineUtils.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "WorldCollision.h"
 
 #include "UnrealCLRFramework.h"
 #include "UnrealCLRLibrary.h"
@@ -54,6 +67,8 @@
 
 UNREALCLR_API DECLARE_LOG_CATEGORY_EXTERN(LogUnrealCLR, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("UnrealCLR"), STATGROUP_UnrealCLR, STATCAT_Advanced);
+
 namespace UnrealCLR {
 	enum struct StatusType : int32 {
 		Stopped,
@@ -99,7 +114,10 @@ namespace UnrealCLR {
 		LoadAssemblies = 2,
 		UnloadAssemblies = 3,
 		Find = 4,
-		Execute = 5
+		Execute = 5,
+		Idle = 6,
+		Trace = 7,
+		Frame = 8
 	};
 
 	enum {
@@ -123,7 +141,8 @@ namespace UnrealCLR {
 		OnComponentBeginCursorOver,
 		OnComponentEndCursorOver,
 		OnComponentClicked,
-		OnComponentReleased
+		OnComponentReleased,
+		EventsCount
 	};
 
 	struct Callback {
@@ -210,36 +229,396 @@ namespace UnrealCLR {
 			this->Value = Value;
 			this->Type = CommandType::Execute;
 		}
+
+		FORCEINLINE Command(CommandType Type, Argument Value) {
+			this->Function = nullptr;
+			this->Value = Value;
+			this->Type = Type;
+		}
+	};
+
+	template <typename CharType>
+	struct ArenaString {
+		const CharType* Data;
+		TArray<CharType> Overflow;
+
+		FORCEINLINE const CharType* operator*() const {
+			return Data;
+		}
+	};
+
+	struct Arena {
+		uint8* Buffer;
+		int64 Capacity;
+		volatile int64 Offset;
+		int64 HighWaterMark;
+		int32 Generation;
+		volatile int32 Overflows;
+
+		void Initialize(int64 Size);
+		void Release();
+		void Reset();
+		void* Allocate(int64 Size);
+		ArenaString<char> CopyString(const TCHAR* Source);
+		ArenaString<TCHAR> ConvertString(const char* Source);
+	};
+
+	struct MutationQueue {
+		static constexpr int32 cacheLineSize = 64;
+
+		struct Entry {
+			volatile int64 Sequence;
+			void* Dispatcher;
+			void* Function;
+			int64 Timestamp;
+			int32 Context;
+			uint8 Padding[4];
+			uint8 Payload[32];
+		};
+
+		Entry* Entries;
+		int64 Capacity;
+		volatile int32 Stalls;
+		volatile int32 Context;
+		uint8 Padding0[cacheLineSize - 24];
+		volatile int64 EnqueuePosition;
+		uint8 Padding1[cacheLineSize - 8];
+		volatile int64 DequeuePosition;
+		uint8 Padding2[cacheLineSize - 8];
+
+		void Initialize(int32 Size);
+		void Release();
+		int32 Peek() const;
+		void Consume(int32 Count);
+	};
+
+	struct DebugDrawBuffer {
+		uint8* Data;
+		int64 Capacity;
+		volatile int64 Offset;
+		volatile int32 Writers;
+		volatile int32 Overflows;
+	};
+
+	struct DebugDraw {
+		DebugDrawBuffer Buffers[2];
+		volatile int32 Current;
+		volatile int32 Context;
+
+		void Initialize(int64 Size);
+		void Release();
+		void Reset();
+		void Submit(UWorld* World, int32 Id);
+	};
+
+	struct TextureUploadBatch {
+		const int32* Ids;
+		int32 Count;
+	};
+
+	struct TextureUploads {
+		TQueue<int32, EQueueMode::Mpsc> Completed;
+		TArray<int32> Released;
+		TextureUploadBatch ReleasedBatch;
+		int32 Pending;
+
+		void Dispatch(bool Flush);
+	};
+
+	struct MutationBatch {
+		int64 Position;
+		int32 Count;
+		int32 Processed;
+		float Latency;
+		int32 Context;
+	};
+
+	struct Telemetry {
+		int64 ExecuteAllocatedBytes;
+		int64 FrameAllocatedBytes;
+		int64 HeapSize;
+		int64 CommittedSize;
+		int64 FragmentedSize;
+		float PauseDuration;
+		int32 Collections[3];
+		int64 EventAllocatedBytes[EventsCount];
+
+		FORCEINLINE void Attribute(int32 Event) {
+			EventAllocatedBytes[Event] += ExecuteAllocatedBytes;
+			ExecuteAllocatedBytes = 0;
+		}
+
+		void Publish();
+	};
+
+	struct Subscriber {
+		void* Function;
+		int32 Priority;
+		int32 Id;
+	};
+
+	struct TimerBatch {
+		const int32* Ids;
+		int32 Count;
+	};
+
+	struct InputBinding {
+		FName Name;
+		int32 Id;
+		bool Axis;
+	};
+
+	struct InputTarget {
+		TWeakObjectPtr<UInputComponent> Component;
+		int32 Player;
+	};
+
+	struct InputBatch {
+		const UnrealCLRFramework::InputEvent* Events;
+		int32 Count;
+		int32 Dropped;
+	};
+
+	struct FixedStep {
+		void* Function;
+		float StepSize;
+		int32 MaxSubsteps;
+		double Accumulator;
+		int32 Substeps;
+		float Alpha;
+	};
+
+	struct TimerWheel {
+		static constexpr int32 slotBits = 6;
+		static constexpr int32 slotsCount = 1 << slotBits;
+		static constexpr int32 levelsCount = 4;
+		static constexpr int32 indexBits = 20;
+		static constexpr int32 indexMask = (1 << indexBits) - 1;
+		static constexpr int32 generationMask = (1 << (31 - indexBits)) - 1;
+		static constexpr double resolution = 1000.0;
+
+		struct Timer {
+			int64 Expiry;
+			int64 Period;
+			int32 Id;
+			int32 Slot;
+			int32 Next;
+			int32 Previous;
+			int32 Generation;
+		};
+
+		TArray<Timer> Timers;
+		TArray<int32> FreeTimers;
+		TArray<int32> Expired;
+		int32 Slots[levelsCount * slotsCount + 1];
+		uint64 Occupied[levelsCount + 1];
+		int64 Current;
+		int32 Count;
+
+		void Initialize(double Time);
+		void Release();
+		int32 Schedule(double Delay, double Period, int32 Id);
+		bool Cancel(int32 Handle);
+		bool IsScheduled(int32 Handle) const;
+		double GetRemaining(int32 Handle) const;
+		void Advance(double Time);
+
+		private:
+
+		Timer* Find(int32 Handle);
+		void Link(int32 Index);
+		void Unlink(int32 Index);
+		void Free(int32 Index);
+		void Cascade(int32 Level);
 	};
 
 	static_assert(sizeof(Callback) == 16, "Invalid size of the [Callback] structure");
 	static_assert(sizeof(Argument) == 24, "Invalid size of the [Argument] structure");
 	static_assert(sizeof(Command) == 40, "Invalid size of the [Command] structure");
+	static_assert(sizeof(Arena) == 40, "Invalid size of the [Arena] structure");
+	static_assert(offsetof(Telemetry, EventAllocatedBytes) == 56, "Invalid layout of the [Telemetry] structure");
+	static_assert(sizeof(Subscriber) == 16, "Invalid size of the [Subscriber] structure");
+	static_assert(sizeof(TimerBatch) == 16, "Invalid size of the [TimerBatch] structure");
+	static_assert(sizeof(FixedStep) == 32, "Invalid size of the [FixedStep] structure");
+	static_assert(sizeof(MutationQueue::Entry) == 72, "Invalid size of the [MutationQueue::Entry] structure");
+	static_assert(offsetof(MutationQueue, EnqueuePosition) == 64 && offsetof(MutationQueue, DequeuePosition) == 128, "Invalid layout of the [MutationQueue] structure");
+	static_assert(sizeof(MutationBatch) == 24, "Invalid size of the [MutationBatch] structure");
+	static_assert(sizeof(DebugDrawBuffer) == 32, "Invalid size of the [DebugDrawBuffer] structure");
 
 	static void* (*ManagedCommand)(Command);
 
+	namespace Capture {
+		static constexpr uint32 version = 1;
+		static constexpr int32 bufferSize = 1024 * 1024;
+
+		enum struct RecordType : uint8 {
+			CommandBegin = 1,
+			CommandEnd = 2,
+			CallBegin = 3,
+			CallEnd = 4
+		};
+
+		struct Binding {
+			const ANSICHAR* Name;
+			const ANSICHAR* Signature;
+			void* Pointer;
+		};
+
+		static TArray<Binding> Bindings;
+		static TArray<uint8> Buffer;
+		static FArchive* Writer;
+		static void* (*HostCommand)(UnrealCLR::Command);
+		static uint64 StartCycles;
+		static int64 Calls;
+		static int32 Checksum;
+		static bool Recording;
+
+		bool Start(const FString& Path);
+		void Stop();
+		void Begin();
+		void Flush();
+		void* Command(UnrealCLR::Command Value);
+		uint16 Register(const ANSICHAR* Name, const ANSICHAR* Signature, void* Pointer);
+		uint64 Timestamp();
+
+		FORCEINLINE void Write(const void* Data, int32 Size) {
+			Buffer.Append(static_cast<const uint8*>(Data), Size);
+
+			if (Buffer.Num() >= bufferSize)
+				Flush();
+		}
+
+		template <typename T>
+		FORCEINLINE void Write(const T& Value) {
+			Write(&Value, sizeof(T));
+		}
+
+		template <typename T>
+		constexpr ANSICHAR Kind() {
+			if constexpr (std::is_void_v<T>) {
+				return 'v';
+			} else if constexpr (std::is_same_v<T, bool>) {
+				return 'b';
+			} else if constexpr (std::is_same_v<T, float>) {
+				return 'f';
+			} else if constexpr (std::is_pointer_v<T>) {
+				return 'p';
+			} else if constexpr ((std::is_integral_v<T> || std::is_enum_v<T>) && sizeof(T) == 8) {
+				return 'l';
+			} else {
+				static_assert((std::is_integral_v<T> || std::is_enum_v<T>) && sizeof(T) == 4, "Unsupported type of the framework function");
+
+				return 'i';
+			}
+		}
+
+		// Framework functions are bound through thunks that count calls made from the game thread, and record their arguments, results, and nested commands between them while capturing
+
+		template <typename T, T Function>
+		struct Thunk;
+
+		template <typename Result, typename... Arguments, Result(*Function)(Arguments...)>
+		struct Thunk<Result(*)(Arguments...), Function> {
+			static constexpr ANSICHAR Signature[] = { Kind<Result>(), '(', Kind<Arguments>()..., ')', '\0' };
+			static inline uint16 Id;
+
+			static Result Invoke(Arguments... Values) {
+				if (!IsInGameThread())
+					return Function(Values...);
+
+				Calls++;
+
+				if (!Recording)
+					return Function(Values...);
+
+				Write(RecordType::CallBegin);
+				Write(Id);
+				(Write(Values), ...);
+
+				const uint64 start = Timestamp();
+
+				if constexpr (std::is_void_v<Result>) {
+					Function(Values...);
+
+					Write(RecordType::CallEnd);
+					Write(Timestamp() - start);
+				} else {
+					const Result result = Function(Values...);
+
+					Write(RecordType::CallEnd);
+					Write(Timestamp() - start);
+					Write(result);
+
+					return result;
+				}
+			}
+		};
+
+		template <typename T, T Function>
+		FORCEINLINE void* Bind(const ANSICHAR* Name) {
+			#if UNREALCLR_CAPTURE
+				Thunk<T, Function>::Id = Register(Name, Thunk<T, Function>::Signature, (void*)&Thunk<T, Function>::Invoke);
+
+				return (void*)&Thunk<T, Function>::Invoke;
+			#else
+				return (void*)Function;
+			#endif
+		}
+	}
+
+	#define UNREALCLR_BIND(Function) UnrealCLR::Capture::Bind<decltype(&Function), &Function>(#Function)
+
 	static FString ProjectPath;
 	static FString UserAssembliesPath;
 
 	static StatusType Status = StatusType::Stopped;
-	static TickState WorldTickState = TickState::Stopped;
+
+	static bool Tracing;
+	static uint64 TracedFrame;
+
+	static Arena FrameArena;
+	static MutationQueue Mutations;
+	static DebugDraw DebugDrawBuffers;
+	static Telemetry ManagedTelemetry;
+	static TextureUploads TextureUploadQueue;
+
+	struct WorldContext;
 
 	struct PrePhysicsTickFunction : public FTickFunction {
+		WorldContext* Context;
+
 		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 		virtual FString DiagnosticMessage() override;
 	};
 
 	struct DuringPhysicsTickFunction : public FTickFunction {
+		WorldContext* Context;
+
 		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 		virtual FString DiagnosticMessage() override;
 	};
 
 	struct PostPhysicsTickFunction : public FTickFunction {
+		WorldContext* Context;
+
 		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 		virtual FString DiagnosticMessage() override;
 	};
 
 	struct PostUpdateTickFunction : public FTickFunction {
+		WorldContext* Context;
+
+		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
+	};
+
+	struct SystemTickFunction : public FTickFunction {
+		WorldContext* Context;
+		void* Function;
+		int32 Event;
+		double StartTime;
+		bool PendingStart;
+
 		virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 		virtual FString DiagnosticMessage() override;
 	};
@@ -252,21 +631,28 @@ namespace UnrealCLR {
 
 		private:
 
+		void Boot();
+		void WaitForBoot();
+		void Trace(const TArray<FString>& Arguments);
+		void Capture(const TArray<FString>& Arguments);
 		void OnWorldPostInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues);
 		void OnWorldCleanup(UWorld* World, bool SessionEnded, bool CleanupResources);
+		void OnEndFrame();
 
-		static void RegisterTickFunction(FTickFunction& TickFunction, ETickingGroup TickGroup, AWorldSettings* LevelActor);
+		static void RegisterTickFunction(FTickFunction& TickFunction, ETickingGroup TickGroup, UWorld* World, UUnrealCLRManager* Manager, AWorldSettings* LevelActor);
 		static void HostError(const char_t* Message);
 		static void Exception(const char* Message);
 		static void Log(UnrealCLR::LogLevel Level, const char* Message);
+		static void RegisterEvent(int32 Event, void* Function);
+		static double LogBootPhase(const TCHAR* Phase, double StartTime);
 
 		FDelegateHandle OnWorldPostInitializationHandle;
 		FDelegateHandle OnWorldCleanupHandle;
+		FDelegateHandle OnEndFrameHandle;
 
-		PrePhysicsTickFunction OnPrePhysicsTickFunction;
-		DuringPhysicsTickFunction OnDuringPhysicsTickFunction;
-		PostPhysicsTickFunction OnPostPhysicsTickFunction;
-		PostUpdateTickFunction OnPostUpdateTickFunction;
+		IConsoleCommand* TraceCommand;
+		IConsoleCommand* CaptureCommand;
+		TFuture<void> BootTask;
 
 		void* HostfxrLibrary;
 	};
@@ -274,10 +660,12 @@ namespace UnrealCLR {
 	namespace Engine {
 		static UUnrealCLRManager* Manager;
 		static UWorld* World;
+		static WorldContext* Context;
 	}
 
 	namespace Shared {
 		static constexpr int32 storageSize = 128;
+		static constexpr int32 subscribersSize = 4096;
 
 		// Non-instantiable
 
@@ -285,11 +673,84 @@ namespace UnrealCLR {
 		static void* CommandLineFunctions[storageSize];
 		static void* DebugFunctions[storageSize];
 		static void* ApplicationFunctions[storageSize];
+		static void* WorldFunctions[storageSize];
+		static void* TickFunctionFunctions[storageSize];
+		static void* TimerFunctions[storageSize];
+		static void* FunctionHandleFunctions[storageSize];
+		static void* ActorQueryFunctions[storageSize];
+		static void* SplineFunctions[storageSize];
+		static void* AnimationBindingFunctions[storageSize];
+		static void* InputFunctions[storageSize];
+		static void* TexturePixelsFunctions[storageSize];
+		static void* MemoryFunctions[storageSize];
 
 		// Instantiable
 
-		static void* RuntimeFunctions[2];
-		static void* Events[128];
+		static void* RuntimeFunctions[3];
+		static TArray<Subscriber> Events[128];
 		static void* Functions[128];
+		static void* TimerHandler;
+		static void* MutationHandler;
+		static void* InputHandler;
+		static void* TextureUploadHandler;
+
+		static int32 SubscriberStates[subscribersSize];
+		static int32 SubscriberEvents[subscribersSize];
 	}
+
+	struct WorldContext {
+		int32 Id;
+		UWorld* World;
+		UUnrealCLRManager* Manager;
+		TickState WorldTickState;
+		TArray<Subscriber> Events[Shared::storageSize];
+		TArray<Subscriber> PendingSubscribers;
+		int32 DispatchingEvent;
+		bool PendingRemoval;
+
+		TMap<int32, TUniquePtr<SystemTickFunction>> SystemTickFunctions;
+		int32 PendingSystemTickFunctions;
+		int32 StaggeredSystemTickFunctions;
+
+		TimerWheel Timers;
+		TimerBatch ExpiredTimers;
+		MutationBatch DrainedMutations;
+
+		TArray<InputBinding> InputBindings;
+		TMap<TWeakObjectPtr<APlayerController>, InputTarget> InputTargets;
+		TArray<UnrealCLRFramework::InputEvent> InputEvents;
+		InputBatch DeliveredInputEvents;
+		int32 InputBindingsHandle;
+		int32 InputEventsCapacity;
+		int32 InputEventsDropped;
+		int32 InputTickGroup;
+
+		FixedStep FixedSteps[OnWorldPostUpdateTick - OnWorldPrePhysicsTick + 1];
+
+		PrePhysicsTickFunction OnPrePhysicsTickFunction;
+		DuringPhysicsTickFunction OnDuringPhysicsTickFunction;
+		PostPhysicsTickFunction OnPostPhysicsTickFunction;
+		PostUpdateTickFunction OnPostUpdateTickFunction;
+
+		void Enter();
+		void Invoke(int32 Event, Argument Value = nullptr);
+		void StartSystemTickFunctions();
+		void DispatchTimers();
+		void DrainMutations(int32 Event);
+		void AddInputBinding(const InputTarget& Target, const InputBinding& Binding);
+		void RebuildInputBindings();
+		void UpdateInputTargets();
+		void DispatchInput(int32 Event);
+		void ReleaseInput();
+		void Step(int32 Event, float DeltaTime);
+	};
+
+	static TArray<TUniquePtr<WorldContext>> WorldContexts;
+	static int32 LastWorldContextId;
+
+	WorldContext* FindWorldContext(int32 Id);
+
+	int32 Subscribe(int32 Event, void* Function, int32 Priority);
+	void Unsubscribe(int32 Id);
+	void ReleaseSubscribers(WorldContext* Context);
 }
\ No newline at end of file
@@ -56,6 +56,284 @@ namespace UnrealCLRFramework {
 		FORCEINLINE operator FColor() const { return FColor(R, G, B, A); }
 	};
 
+	enum struct CollisionShapeType : int32 {
+		Line,
+		Box,
+		Sphere,
+		Capsule
+	};
+
+	struct Vector3 {
+		float X;
+		float Y;
+		float Z;
+
+		FORCEINLINE Vector3() : X(), Y(), Z() { }
+
+		FORCEINLINE Vector3(const FVector& Value) {
+			this->X = Value.X;
+			this->Y = Value.Y;
+			this->Z = Value.Z;
+		}
+
+		FORCEINLINE operator FVector() const { return FVector(X, Y, Z); }
+	};
+
+	struct Quaternion {
+		float X;
+		float Y;
+		float Z;
+		float W;
+
+		FORCEINLINE Quaternion(const FQuat& Value) {
+			this->X = Value.X;
+			this->Y = Value.Y;
+			this->Z = Value.Z;
+			this->W = Value.W;
+		}
+
+		FORCEINLINE operator FQuat() const { return FQuat(X, Y, Z, W); }
+	};
+
+	struct Transform {
+		Vector3 Location;
+		Quaternion Rotation;
+		Vector3 Scale;
+
+		FORCEINLINE Transform(const FTransform& Value) : Location(Value.GetLocation()), Rotation(Value.GetRotation()), Scale(Value.GetScale3D()) { }
+
+		FORCEINLINE operator FTransform() const { return FTransform(Rotation, Location, Scale); }
+	};
+
+	enum struct SplineSampleMode : int32 {
+		Distance,
+		Time,
+		TimeWithConstantVelocity
+	};
+
+	enum struct InputEventType : int32 {
+		Pressed,
+		Released,
+		Axis
+	};
+
+	struct InputEvent {
+		int32 Binding;
+		InputEventType Type;
+		float Value;
+		int32 Player;
+		double Timestamp;
+	};
+
+	struct TextureRegion {
+		int32 DestinationX;
+		int32 DestinationY;
+		int32 SourceX;
+		int32 SourceY;
+		int32 Width;
+		int32 Height;
+	};
+
+	struct CollisionShape {
+		CollisionShapeType ShapeType;
+		union {
+			Vector3 Box;
+			float Sphere;
+			struct {
+				float Radius;
+				float HalfHeight;
+			} Capsule;
+		};
+
+		FORCEINLINE operator FCollisionShape() const {
+			if (ShapeType == CollisionShapeType::Box)
+				return FCollisionShape::MakeBox(Box);
+
+			if (ShapeType == CollisionShapeType::Sphere)
+				return FCollisionShape::MakeSphere(Sphere);
+
+			if (ShapeType == CollisionShapeType::Capsule)
+				return FCollisionShape::MakeCapsule(Capsule.Radius, Capsule.HalfHeight);
+
+			return FCollisionShape();
+		}
+	};
+
+	enum struct DebugDrawType : int32 {
+		Line = 1,
+		Point,
+		Box,
+		Capsule,
+		Cone,
+		Cylinder,
+		Sphere,
+		Message,
+		ClearMessages,
+		FlushPersistentLines
+	};
+
+	struct DebugDrawHeader {
+		DebugDrawType Type;
+		int32 Size;
+		int32 Context;
+	};
+
+	struct DebugDrawStyle {
+		Color DrawColor;
+		float LifeTime;
+		float Thickness;
+		uint8 DepthPriority;
+		bool Persistent;
+	};
+
+	struct DebugLine {
+		DebugDrawStyle Style;
+		Vector3 Start;
+		Vector3 End;
+	};
+
+	struct DebugPoint {
+		DebugDrawStyle Style;
+		Vector3 Location;
+		float Size;
+	};
+
+	struct DebugBox {
+		DebugDrawStyle Style;
+		Vector3 Center;
+		Vector3 Extent;
+		Quaternion Rotation;
+	};
+
+	struct DebugCapsule {
+		DebugDrawStyle Style;
+		Vector3 Center;
+		float HalfHeight;
+		float Radius;
+		Quaternion Rotation;
+	};
+
+	struct DebugCone {
+		DebugDrawStyle Style;
+		Vector3 Origin;
+		Vector3 Direction;
+		float Length;
+		float AngleWidth;
+		float AngleHeight;
+		int32 Sides;
+	};
+
+	struct DebugCylinder {
+		DebugDrawStyle Style;
+		Vector3 Start;
+		Vector3 End;
+		float Radius;
+		int32 Segments;
+	};
+
+	struct DebugSphere {
+		DebugDrawStyle Style;
+		Vector3 Center;
+		float Radius;
+		int32 Segments;
+	};
+
+	struct DebugMessage {
+		int32 Key;
+		float TimeToDisplay;
+		Color DisplayColor;
+		int32 Length;
+	};
+
+	struct TraceQuery {
+		Vector3 Start;
+		Vector3 End;
+		Quaternion Rotation;
+		CollisionShape Shape;
+		int32 Channel;
+		bool TraceComplex;
+		AActor* IgnoredActor;
+	};
+
+	struct Hit {
+		Vector3 Location;
+		Vector3 ImpactLocation;
+		Vector3 Normal;
+		Vector3 ImpactNormal;
+		Vector3 TraceStart;
+		Vector3 TraceEnd;
+		AActor* Actor;
+		float Time;
+		float Distance;
+		float PenetrationDepth;
+		bool BlockingHit;
+		bool StartPenetrating;
+
+		FORCEINLINE Hit(const FHitResult& Value) {
+			this->Location = Value.Location;
+			this->ImpactLocation = Value.ImpactPoint;
+			this->Normal = Value.Normal;
+			this->ImpactNormal = Value.ImpactNormal;
+			this->TraceStart = Value.TraceStart;
+			this->TraceEnd = Value.TraceEnd;
+			this->Actor = Value.GetActor();
+			this->Time = Value.Time;
+			this->Distance = Value.Distance;
+			this->PenetrationDepth = Value.PenetrationDepth;
+			this->BlockingHit = Value.bBlockingHit;
+			this->StartPenetrating = Value.bStartPenetrating;
+		}
+	};
+
+	struct ActorQueryDescription {
+		const char* ActorClass;
+		const char* ComponentClass;
+		const char* const* Tags;
+		int32 TagsCount;
+		bool Incremental;
+		bool UseBounds;
+		Vector3 BoundsMin;
+		Vector3 BoundsMax;
+	};
+
+	struct EnvironmentArgument {
+		const char* Key;
+		const char* Value;
+	};
+
+	struct Environment {
+		volatile int32 Version;
+		bool IsCanEverRender;
+		bool IsPackagedForDistribution;
+		bool IsPackagedForShipping;
+		const char* ProjectDirectory;
+		const char* DefaultLanguage;
+		const char* ProjectName;
+		const char* CommandLine;
+		const EnvironmentArgument* Arguments;
+		int32 ArgumentsCount;
+	};
+
+	static_assert(sizeof(EnvironmentArgument) == 16, "Invalid size of the [EnvironmentArgument] structure");
+	static_assert(sizeof(Environment) == 56, "Invalid size of the [Environment] structure");
+	static_assert(sizeof(DebugDrawHeader) == 12, "Invalid size of the [DebugDrawHeader] structure");
+	static_assert(sizeof(DebugDrawStyle) == 16, "Invalid size of the [DebugDrawStyle] structure");
+	static_assert(sizeof(DebugLine) == 40, "Invalid size of the [DebugLine] structure");
+	static_assert(sizeof(DebugPoint) == 32, "Invalid size of the [DebugPoint] structure");
+	static_assert(sizeof(DebugBox) == 56, "Invalid size of the [DebugBox] structure");
+	static_assert(sizeof(DebugCapsule) == 52, "Invalid size of the [DebugCapsule] structure");
+	static_assert(sizeof(DebugCone) == 56, "Invalid size of the [DebugCone] structure");
+	static_assert(sizeof(DebugCylinder) == 48, "Invalid size of the [DebugCylinder] structure");
+	static_assert(sizeof(DebugSphere) == 36, "Invalid size of the [DebugSphere] structure");
+	static_assert(sizeof(DebugMessage) == 16, "Invalid size of the [DebugMessage] structure");
+	static_assert(sizeof(Transform) == 40, "Invalid size of the [Transform] structure");
+	static_assert(sizeof(InputEvent) == 24, "Invalid size of the [InputEvent] structure");
+	static_assert(sizeof(TextureRegion) == 24, "Invalid size of the [TextureRegion] structure");
+	static_assert(sizeof(CollisionShape) == 16, "Invalid size of the [CollisionShape] structure");
+	static_assert(sizeof(TraceQuery) == 72, "Invalid size of the [TraceQuery] structure");
+	static_assert(sizeof(Hit) == 96, "Invalid size of the [Hit] structure");
+	static_assert(sizeof(ActorQueryDescription) == 56, "Invalid size of the [ActorQueryDescription] structure");
+
 	// Enumerable
 	// 
 	// Non-instantiable
@@ -65,7 +343,6 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace CommandLine {
-		void Get(char* Arguments);
 		void Set(const char* Arguments);
 		void Append(const char* Arguments);
 	}
@@ -73,21 +350,104 @@ namespace UnrealCLRFramework {
 	namespace Debug {
 		void Log(LogLevel Level, const char* Message);
 		void Exception(const char* Exception);
-		void AddOnScreenMessage(int32 Key, float TimeToDisplay, Color DisplayColor, const char* Message);
-		void ClearOnScreenMessages();
 	}
 
 	namespace Application {
-		bool IsCanEverRender();
-		bool IsPackagedForDistribution();
-		bool IsPackagedForShipping();
-		void GetProjectDirectory(char* Directory);
-		void GetDefaultLanguage(char* Language);
-		void GetProjectName(char* ProjectName);
+		const Environment* GetEnvironment();
+		void PublishEnvironment();
+		int64 GetInteropCalls();
 		float GetVolumeMultiplier();
 		void SetProjectName(const char* ProjectName);
 		void SetVolumeMultiplier(float Value);
-		void RequestExit(bool Force);
+		void RequestExit(bool Force, int32 ReturnCode);
+	}
+
+	namespace World {
+		int32 TraceBatch(const TraceQuery* Queries, Hit* Results, int32 Count);
+		int32 SubmitTraceBatch(const TraceQuery* Queries, Hit* Results, int32 Count);
+		int32 QueryTraceBatch(int32 Handle);
+		void ReleaseTraceBatches(UWorld* World);
+		void ExpireTraceBatches();
+		int32 Subscribe(int32 TickGroup, void* Function, int32 Priority);
+		void Unsubscribe(int32 Subscription);
+		int32* GetSubscriberStates();
+		bool SetFixedStep(int32 TickGroup, void* Function, float StepSize, int32 MaxSubsteps, void** Previous);
+		float GetInterpolationAlpha(int32 TickGroup);
+		AActor* FindActor(const char* Name);
+		AActor* FindActorByTag(const char* Tag);
+		AActor* FindActorByID(uint32 Id);
+		void ReleaseActorIndex(UWorld* World);
+	}
+
+	namespace TickFunction {
+		int32 Create(int32 TickGroup, void* Function, float Interval);
+		void Destroy(int32 Handle);
+		void SetEnabled(int32 Handle, bool Value);
+		void SetInterval(int32 Handle, float Value);
+		void AddPrerequisite(int32 Handle, UObject* Prerequisite);
+		void AddTickFunctionPrerequisite(int32 Handle, int32 Prerequisite);
+	}
+
+	namespace Timer {
+		void SetHandler(void* Function);
+		int32 Schedule(float Delay, float Period, int32 Id);
+		bool Cancel(int32 Handle);
+		bool IsScheduled(int32 Handle);
+		float GetRemaining(int32 Handle);
+		int32 GetCount();
+	}
+
+	namespace FunctionHandle {
+		int32 Resolve(UObject* Object, const char* Name, int32* ParametersSize);
+		void* GetParameters(int32 Handle);
+		int32 GetParameterOffset(int32 Handle, const char* Name);
+		bool Invoke(int32 Handle, UObject* Object);
+		void Release(int32 Handle);
+		void ReleaseAll();
+	}
+
+	namespace ActorQuery {
+		int32 Create(const ActorQueryDescription* Description);
+		AActor** Update(int32 Handle, int32* Count);
+		void Release(int32 Handle);
+		void ReleaseAll(UWorld* World);
+	}
+
+	namespace Spline {
+		bool Sample(UObject* SplineComponent, const float* Keys, int32 Count, SplineSampleMode Mode, int32 CoordinateSpace, Vector3* Locations, Vector3* Tangents, Quaternion* Rotations, Transform* Transforms);
+		bool SetPoints(UObject* SplineComponent, const Vector3* Locations, const Vector3* Tangents, int32 Count, int32 CoordinateSpace);
+		bool UpdatePoints(UObject* SplineComponent, const int32* Indices, const Vector3* Locations, const Vector3* Tangents, int32 Count, int32 CoordinateSpace);
+	}
+
+	namespace AnimationBinding {
+		int32 Create(const char* const* Curves, int32 CurvesCount, const char* const* Parameters, int32 ParametersCount);
+		int32 Read(int32 Handle, UObject** Instances, int32 Count, float* Curves, float* Parameters);
+		int32 Write(int32 Handle, UObject** Instances, int32 Count, const float* Parameters);
+		void Release(int32 Handle);
+		void ReleaseAll();
+	}
+
+	namespace Input {
+		void SetHandler(void* Function);
+		bool SetTickGroup(int32 TickGroup);
+		int32 BindAction(const char* Name);
+		int32 BindAxis(const char* Name);
+		bool Unbind(int32 Binding);
+	}
+
+	namespace TexturePixels {
+		void SetHandler(void* Function);
+		uint8* Lock(UObject* Texture, int32 Mip, int32* Width, int32* Height, int32* Size);
+		bool Unlock(UObject* Texture, int32 Mip, bool UpdateResource);
+		bool UpdateRegions(UObject* Texture, int32 Mip, const TextureRegion* Regions, int32 RegionsCount, int32 Pitch, int32 BytesPerPixel, uint8* Data, int32 Id);
+	}
+
+	namespace Memory {
+		void* GetFrameArena();
+		void* GetMutationQueue();
+		void SetMutationHandler(void* Function);
+		void* GetDebugDraw();
+		bool IsInGameThread();
 	}
 
 }
\ No newline at end of file
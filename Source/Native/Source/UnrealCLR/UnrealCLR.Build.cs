@@ -43,6 +43,8 @@ public class UnrealCLR : ModuleRules
 			);
 		
 		
+		PrivateDefinitions.Add("UNREALCLR_CAPTURE=" + (Target.Configuration != UnrealTargetConfiguration.Shipping ? "1" : "0"));
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{